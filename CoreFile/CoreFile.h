@@ -24,5 +24,29 @@
 // Export Headers                                                             //
 //----------------------------------------------------------------------------//
 #include "include/CoreFile.h"
+#include "include/Appender.h"
+#include "include/AsyncFile.h"
+#include "include/Backend.h"
+#include "include/BinaryReader.h"
+#include "include/BinaryWriter.h"
+#include "include/BulkCopy.h"
+#include "include/Compression.h"
 #include "include/Config.h"
+#include "include/Coroutines.h"
 #include "include/CoreFile_Utils.h"
+#include "include/DirectIO.h"
+#include "include/Endian.h"
+#include "include/FileCache.h"
+#include "include/FileTime.h"
+#include "include/FileWatcher.h"
+#include "include/Handle.h"
+#include "include/HandleStream.h"
+#include "include/Instrumentation.h"
+#include "include/LineIndex.h"
+#include "include/LineReader.h"
+#include "include/MappedFile.h"
+#include "include/MemoryBackend.h"
+#include "include/Metadata.h"
+#include "include/OpenOptions.h"
+#include "include/OverlayBackend.h"
+#include "include/ParallelRead.h"
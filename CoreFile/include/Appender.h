@@ -0,0 +1,149 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Appender.h                                                    //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+
+
+NS_COREFILE_BEGIN
+
+// Forward declarations.
+namespace Private { class AppenderImpl; }
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Long lived appender - Alternative to AppendAllText / AppendAllLines
+///   for many small appends from many threads.
+///   The file is kept open and each record is handed to a background
+///   writer through a lock-free queue. The writer coalesces the queued
+///   records into writev(2) batches and, when a durability is requested,
+///   flushes each batch once (group commit).
+/// @note
+///   Records are never interleaved with each other - Each one is written
+///   contiguously. Records from a single thread keep their order.
+/// @see AppendAllText, AppendAllLines
+class Appender
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Group commit settings.
+    struct Options
+    {
+        Options() :
+            durability   (Durability::None),
+            maxLatency   (std::chrono::microseconds(0)),
+            maxBatchBytes(1024 * 1024)
+        {
+            // Empty...
+        }
+
+        /// How much each batch is flushed to disk.
+        Durability durability;
+
+        /// How long a record may wait for more records to join its batch.
+        /// Zero writes as soon as the writer wakes up.
+        std::chrono::microseconds maxLatency;
+
+        /// A batch is committed as soon as it reaches this size.
+        size_t maxBatchBytes;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Opens (or creates) the file for appending.
+    /// @throws std::ios::failure if the file couldn't be opened.
+    explicit Appender(
+        const std::string &filename,
+        const Options     &options = Options());
+
+    ///-------------------------------------------------------------------------
+    /// @brief Commits all the pending records and closes the file.
+    /// @warning
+    ///   A write error of those records is silently dropped - Call
+    ///   Flush before destroying it to see the errors.
+    ~Appender();
+
+    Appender(const Appender &)            = delete;
+    Appender& operator =(const Appender &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Queues a record - Thread safe and lock free.
+    /// @throws
+    ///   std::runtime_error if a previous batch failed to be written.
+    void Append(const std::string &record);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Queues a record - @see Append.
+    void Append(const void *pData, size_t size);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Queues the line followed by CoreFS::NewLine().
+    void AppendLine(const std::string &line);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Blocks until all the records appended before the call are
+    ///   written (and flushed, according the durability).
+    /// @throws std::runtime_error if the write failed.
+    void Flush();
+
+    ///-------------------------------------------------------------------------
+    /// @brief The name of the file.
+    const std::string& GetFilename() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Number of bytes written so far.
+    uint64_t GetBytesWritten() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Number of batches (writev + optional sync) committed so far.
+    uint64_t GetBatchesCommitted() const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::unique_ptr<Private::AppenderImpl> m_pImpl;
+};
+
+NS_COREFILE_END
@@ -0,0 +1,269 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : AsyncFile.h                                                   //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+// Forward declarations.
+namespace Private { class AsyncEngine; }
+
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief The mechanism used by AsyncIO to perform the operations.
+enum class AsyncBackend
+{
+    Auto,       ///< io_uring when available, ThreadPool otherwise.
+    IoUring,    ///< Linux io_uring - Operations are completed by the kernel.
+    ThreadPool  ///< Worker threads doing blocking pread(2) / pwrite(2).
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Called when an asynchronous operation completes.
+///   Arguments are: errno value (0 on success) and the number of
+///   bytes transferred - Smaller than requested only at end of file.
+/// @warning
+///   Callbacks run on the AsyncIO internal threads, they should be
+///   short and must not throw.
+typedef std::function<void (int, size_t)> AsyncCallback;
+
+///-----------------------------------------------------------------------------
+/// @brief A single asynchronous positioned read or write.
+struct AsyncOperation
+{
+    enum class Type { Read, Write };
+
+    Type          type;
+    int           fd;
+    void         *pBuffer; ///< Must stay valid until completion.
+    size_t        size;
+    uint64_t      offset;
+    AsyncCallback callback;
+};
+
+
+//----------------------------------------------------------------------------//
+// AsyncIO                                                                    //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Engine that executes asynchronous file operations without a thread
+///   per file. Backed by io_uring when the kernel allows it and by a
+///   pool of threads doing pread(2) / pwrite(2) otherwise.
+/// @note
+///   The destructor waits for all the pending operations.
+class AsyncIO
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Creates the engine.
+    /// @param backend
+    ///   The desired backend - Requesting IoUring on a system that
+    ///   doesn't support it throws std::runtime_error.
+    /// @param queueDepth
+    ///   Max operations in flight for io_uring.
+    /// @param threads
+    ///   Number of threads of the ThreadPool backend -
+    ///   0 means std::thread::hardware_concurrency.
+    explicit AsyncIO(
+        AsyncBackend backend    = AsyncBackend::Auto,
+        size_t       queueDepth = 256,
+        size_t       threads    = 0);
+
+    ~AsyncIO();
+
+    AsyncIO(const AsyncIO &)            = delete;
+    AsyncIO& operator =(const AsyncIO &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Process wide engine with the Auto backend.
+    static AsyncIO& GetDefault();
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Submits a single operation.
+    void Submit(const AsyncOperation &operation);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Submits many operations at once - With io_uring they're all
+    ///   queued and sent to the kernel with a single system call.
+    void Submit(const std::vector<AsyncOperation> &operations);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads size bytes at offset of fd into pBuffer.
+    /// @returns
+    ///   A future with the number of bytes read.
+    ///   It holds a std::runtime_error if the read fails.
+    std::future<size_t> Read(
+        int       fd,
+        void     *pBuffer,
+        size_t    size,
+        uint64_t  offset);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes size bytes of pBuffer at offset of fd.
+    /// @returns
+    ///   A future with the number of bytes written.
+    ///   It holds a std::runtime_error if the write fails.
+    std::future<size_t> Write(
+        int         fd,
+        const void *pBuffer,
+        size_t      size,
+        uint64_t    offset);
+
+    ///-------------------------------------------------------------------------
+    /// @brief The backend actually used by this engine.
+    AsyncBackend GetBackend() const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::unique_ptr<Private::AsyncEngine> m_pEngine;
+};
+
+
+//----------------------------------------------------------------------------//
+// AsyncFile                                                                  //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   A file whose reads and writes are performed by an AsyncIO engine.
+///   Operations return futures or call completion callbacks.
+/// @warning
+///   The file must outlive its pending operations.
+class AsyncFile
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Opens the file.
+    /// @param filename
+    ///   The name of the file that will be opened.
+    /// @param filemode
+    ///   The desired file mode - Same values accepted by Open.
+    /// @param io
+    ///   The engine that will execute the operations.
+    /// @throws std::ios::failure if the file couldn't be opened.
+    /// @see FileMode
+    AsyncFile(
+        const std::string &filename,
+        const std::string &filemode,
+        AsyncIO           &io = AsyncIO::GetDefault());
+
+    ~AsyncFile();
+
+    AsyncFile(AsyncFile &&other);
+    AsyncFile& operator =(AsyncFile &&other);
+
+    AsyncFile(const AsyncFile &)            = delete;
+    AsyncFile& operator =(const AsyncFile &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Reads size bytes at offset - @see AsyncIO::Read.
+    std::future<size_t> ReadAt(void *pBuffer, size_t size, uint64_t offset);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads size bytes at offset and calls callback when done.
+    void ReadAt(
+        void                *pBuffer,
+        size_t               size,
+        uint64_t             offset,
+        const AsyncCallback &callback);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes size bytes at offset - @see AsyncIO::Write.
+    std::future<size_t> WriteAt(const void *pBuffer, size_t size, uint64_t offset);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes size bytes at offset and calls callback when done.
+    void WriteAt(
+        const void          *pBuffer,
+        size_t               size,
+        uint64_t             offset,
+        const AsyncCallback &callback);
+
+    ///-------------------------------------------------------------------------
+    /// @brief The current size of the file in bytes.
+    size_t GetSize() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The underlying file descriptor.
+    int GetFd() const { return m_fd; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The name of the file.
+    const std::string& GetFilename() const { return m_filename; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The engine used by this file.
+    AsyncIO& GetIO() const { return *m_pIO; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string  m_filename;
+    int          m_fd;
+    AsyncIO     *m_pIO;
+};
+
+NS_COREFILE_END
@@ -0,0 +1,169 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Backend.h                                                     //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Where the whole file functions (ReadAll*, WriteAll*, AppendAll*,
+///   Copy, Move, Replace, Delete, Exist and GetSize) take the files from.
+///   The default is the POSIX one (@see GetPosixBackend) - Another one
+///   can be selected for the calling thread with ScopedBackend, or its
+///   methods can be called directly.
+/// @note
+///   The stream / descriptor based APIs (Open, Handle, MappedFile...)
+///   and the Get / Set * Time functions always use the OS.
+///
+///   Backends can be stacked (@see OverlayBackend) - A caching or
+///   tracing layer is a Backend that forwards to another one.
+/// @see MemoryBackend, OverlayBackend
+class Backend
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    virtual ~Backend();
+
+
+    //------------------------------------------------------------------------//
+    // Interface                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Reads the whole file.
+    /// @returns
+    ///   false if the file doesn't exist or isn't a regular file - The
+    ///   contents are empty then.
+    /// @throws std::runtime_error on read errors.
+    virtual bool ReadFile(const std::string &filename, std::string         &contents) = 0;
+    virtual bool ReadFile(const std::string &filename, std::vector<byte_t> &contents) = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Creates or replaces the file with the bytes.
+    /// @throws
+    ///   std::ios::failure if the file couldn't be opened and
+    ///   std::runtime_error on write errors.
+    /// @see WriteAllBytes
+    virtual void WriteFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size,
+        WriteMode          mode,
+        Durability         durability) = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Appends the bytes to the file, creating it if needed.
+    /// @throws
+    ///   std::ios::failure if the file couldn't be opened and
+    ///   std::runtime_error on write errors.
+    virtual void AppendFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size) = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Deletes the file.
+    /// @returns false if the file couldn't be deleted.
+    virtual bool DeleteFile(const std::string &filename) = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief If the file exists and is a regular file.
+    virtual bool IsFile(const std::string &filename) = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The size of the file - 0 if it isn't a regular file.
+    virtual size_t GetFileSize(const std::string &filename) = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Copies the file - Same contract of CoreFile::Copy.
+    ///   The default reads the whole source and writes it back.
+    virtual void CopyFile(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Moves the file - Same contract of CoreFile::Move.
+    ///   The default copies the file and deletes the source.
+    virtual void MoveFile(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Replaces dst with src, optionally keeping a backup of dst -
+    ///   Same contract of CoreFile::Replace (both files exist).
+    ///   The default copies dst to the backup and moves src over dst.
+    /// @param backup Name of the backup of dst - Empty means no backup.
+    virtual void ReplaceFile(
+        const std::string &src,
+        const std::string &dst,
+        const std::string &backup);
+};
+
+
+//----------------------------------------------------------------------------//
+// Selection                                                                  //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief The backend that goes straight to the OS - The default one.
+Backend& GetPosixBackend();
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The backend used by the whole file functions on the calling
+///   thread - @see ScopedBackend.
+Backend& GetCurrentBackend();
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Selects the backend of the calling thread while in scope - The
+///   previous one is restored at the end, so they can be nested.
+/// @note
+///   Other threads aren't affected - CopyMany / MoveMany hand the
+///   caller's backend to their workers, though.
+class ScopedBackend
+{
+public:
+    explicit ScopedBackend(Backend &backend);
+    ~ScopedBackend();
+
+    ScopedBackend(const ScopedBackend &)            = delete;
+    ScopedBackend& operator =(const ScopedBackend &) = delete;
+
+private:
+    Backend *m_pPrevious;
+};
+
+NS_COREFILE_END
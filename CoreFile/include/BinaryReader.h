@@ -0,0 +1,233 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BinaryReader.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+#include "Endian.h"
+#include "Handle.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Buffered reader of binary records.
+///   Reads big blocks from the file and decodes the fields from memory,
+///   instead of one std::fstream::read call per field.
+/// @note
+///   The byte order is a template argument of each call, so the swap
+///   only exists in the code when the file order isn't the native one:
+///   @code
+///     auto id    = reader.Read<uint32_t>();               // Little.
+///     auto value = reader.Read<double, Endian::Big>();
+///   @endcode
+///   Reading past the end of the file throws std::runtime_error.
+///   BinaryReader is move-only.
+/// @see BinaryWriter
+class BinaryReader
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr size_t kDefaultBufferSize = 256 * 1024;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Opens the file for reading.
+    /// @throws std::ios::failure if the file couldn't be opened.
+    explicit BinaryReader(
+        const std::string &filename,
+        size_t             bufferSize = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads from the current position of the handle.
+    explicit BinaryReader(
+        Handle handle,
+        size_t bufferSize = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads from the stream (i.e. the ones returned by OpenRead).
+    ///   The stream isn't owned and must outlive the reader.
+    explicit BinaryReader(
+        std::istream &stream,
+        size_t        bufferSize = kDefaultBufferSize);
+
+    BinaryReader(BinaryReader &&)             = default;
+    BinaryReader& operator =(BinaryReader &&) = default;
+
+    BinaryReader(const BinaryReader &)            = delete;
+    BinaryReader& operator =(const BinaryReader &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Primitives                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Reads an integer or floating point value.
+    /// @tparam T     The type of the value.
+    /// @tparam Order The byte order of the value in the file.
+    /// @throws std::runtime_error on read errors or end of file.
+    template <typename T, Endian Order = Endian::Little>
+    T Read();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads count values straight into pValues - Big arrays bypass the
+    ///   internal buffer and are read directly into the caller's memory.
+    /// @throws std::runtime_error on read errors or end of file.
+    template <typename T, Endian Order = Endian::Little>
+    void ReadArray(T *pValues, size_t count);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads exactly size bytes into pData.
+    /// @throws std::runtime_error on read errors or end of file.
+    void ReadBytes(void *pData, size_t size);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Advances size bytes without decoding them.
+    /// @throws std::runtime_error on read errors or end of file.
+    void Skip(uint64_t size);
+
+
+    //------------------------------------------------------------------------//
+    // Variable Length                                                        //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Reads an unsigned LEB128 varint (1 to 10 bytes).
+    /// @throws std::runtime_error if the varint is malformed.
+    uint64_t ReadVarUInt();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads a zigzag encoded signed varint.
+    /// @throws std::runtime_error if the varint is malformed.
+    int64_t ReadVarInt();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads a blob prefixed by its size as a varint.
+    /// @note
+    ///   The memory grows as the bytes are read, so a corrupt size
+    ///   fails with end of file instead of a huge allocation.
+    /// @throws std::runtime_error on read errors or end of file.
+    /// @see BinaryWriter::WriteBlob
+    std::vector<byte_t> ReadBlob();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads a string prefixed by its size as a varint.
+    /// @note Same of ReadBlob - A corrupt size fails with end of file.
+    /// @throws std::runtime_error on read errors or end of file.
+    /// @see BinaryWriter::WriteString
+    std::string ReadString();
+
+
+    //------------------------------------------------------------------------//
+    // State                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief If there's nothing left to read.
+    /// @note It may need to read from the file to find out.
+    bool IsEndOfFile();
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many bytes were consumed since the reader was created.
+    uint64_t GetPosition() const { return m_position; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    size_t Available() const { return m_end - m_begin; }
+
+    void   Require      (size_t size);
+    size_t Fill         ();
+    size_t ReadFromSource(void *pData, size_t size);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Handle        m_handle;
+    std::istream *m_pStream;
+
+    std::vector<byte_t> m_buffer;
+    size_t              m_begin;
+    size_t              m_end;
+    uint64_t            m_position;
+};
+
+
+//----------------------------------------------------------------------------//
+// Template Implementation                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+template <typename T, Endian Order>
+inline T BinaryReader::Read()
+{
+    // Slow path only when the value crosses the end of the buffer.
+    if(Available() < sizeof(T))
+        Require(sizeof(T));
+
+    T value;
+    std::memcpy(&value, &m_buffer[m_begin], sizeof(T));
+
+    m_begin    += sizeof(T);
+    m_position += sizeof(T);
+
+    return ConvertEndian<Order>(value);
+}
+
+//------------------------------------------------------------------------------
+template <typename T, Endian Order>
+inline void BinaryReader::ReadArray(T *pValues, size_t count)
+{
+    static_assert(
+        std::is_arithmetic<T>::value,
+        "ReadArray only works with integer and floating point types"
+    );
+
+    ReadBytes(pValues, count * sizeof(T));
+
+    if(Order != Endian::Native)
+    {
+        for(size_t i = 0; i < count; ++i)
+            pValues[i] = ConvertEndian<Order>(pValues[i]);
+    }
+}
+
+NS_COREFILE_END
@@ -0,0 +1,212 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BinaryWriter.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+#include "Endian.h"
+#include "Handle.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Buffered writer of binary records - Counterpart of BinaryReader.
+///   The fields are encoded in memory and sent to the file in big
+///   blocks.
+/// @note
+///   The destructor flushes the pending bytes but can't report errors,
+///   call Flush to be sure that everything was written.
+///   BinaryWriter is move-only.
+/// @see BinaryReader
+class BinaryWriter
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr size_t kDefaultBufferSize = 256 * 1024;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Creates (or truncates) the file for writing.
+    /// @throws std::ios::failure if the file couldn't be opened.
+    explicit BinaryWriter(
+        const std::string &filename,
+        size_t             bufferSize = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes at the current position of the handle.
+    explicit BinaryWriter(
+        Handle handle,
+        size_t bufferSize = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes to the stream (i.e. the ones returned by OpenWrite).
+    ///   The stream isn't owned and must outlive the writer.
+    explicit BinaryWriter(
+        std::ostream &stream,
+        size_t        bufferSize = kDefaultBufferSize);
+
+    ~BinaryWriter();
+
+    BinaryWriter(BinaryWriter &&other);
+    BinaryWriter& operator =(BinaryWriter &&other);
+
+    BinaryWriter(const BinaryWriter &)            = delete;
+    BinaryWriter& operator =(const BinaryWriter &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Primitives                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Writes an integer or floating point value.
+    /// @tparam T     The type of the value.
+    /// @tparam Order The byte order of the value in the file.
+    /// @throws std::runtime_error on write errors.
+    template <typename T, Endian Order = Endian::Little>
+    void Write(T value);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes count values - When no swap is needed big arrays bypass
+    ///   the internal buffer and are written straight from pValues.
+    /// @throws std::runtime_error on write errors.
+    template <typename T, Endian Order = Endian::Little>
+    void WriteArray(const T *pValues, size_t count);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes size bytes as they are.
+    /// @throws std::runtime_error on write errors.
+    void WriteBytes(const void *pData, size_t size);
+
+
+    //------------------------------------------------------------------------//
+    // Variable Length                                                        //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Writes an unsigned LEB128 varint (1 to 10 bytes).
+    void WriteVarUInt(uint64_t value);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes a zigzag encoded signed varint.
+    void WriteVarInt(int64_t value);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the blob prefixed by its size as a varint.
+    void WriteBlob(const void *pData, size_t size);
+    void WriteBlob(const std::vector<byte_t> &blob);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the string prefixed by its size as a varint.
+    void WriteString(const std::string &str);
+
+
+    //------------------------------------------------------------------------//
+    // State                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Sends the buffered bytes to the file (or stream).
+    /// @throws std::runtime_error on write errors.
+    void Flush();
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many bytes were written (buffered ones included).
+    uint64_t GetPosition() const { return m_position; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    size_t Free() const { return m_buffer.size() - m_used; }
+
+    void FlushBuffer ();
+    void WriteToSink (const void *pData, size_t size);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Handle        m_handle;
+    std::ostream *m_pStream;
+
+    std::vector<byte_t> m_buffer;
+    size_t              m_used;
+    uint64_t            m_position;
+};
+
+
+//----------------------------------------------------------------------------//
+// Template Implementation                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+template <typename T, Endian Order>
+inline void BinaryWriter::Write(T value)
+{
+    if(Free() < sizeof(T))
+        FlushBuffer();
+
+    value = ConvertEndian<Order>(value);
+    std::memcpy(&m_buffer[m_used], &value, sizeof(T));
+
+    m_used     += sizeof(T);
+    m_position += sizeof(T);
+}
+
+//------------------------------------------------------------------------------
+template <typename T, Endian Order>
+inline void BinaryWriter::WriteArray(const T *pValues, size_t count)
+{
+    static_assert(
+        std::is_arithmetic<T>::value,
+        "WriteArray only works with integer and floating point types"
+    );
+
+    if(Order == Endian::Native)
+    {
+        WriteBytes(pValues, count * sizeof(T));
+        return;
+    }
+
+    for(size_t i = 0; i < count; ++i)
+        Write<T, Order>(pValues[i]);
+}
+
+NS_COREFILE_END
@@ -0,0 +1,128 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BulkCopy.h                                                    //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief How often the progress callback is called.
+constexpr std::chrono::milliseconds kBulkProgressInterval =
+    std::chrono::milliseconds(100);
+
+///-----------------------------------------------------------------------------
+/// @brief A file to be copied / moved.
+struct BulkJob
+{
+    std::string src;
+    std::string dst;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief Snapshot of a CopyMany / MoveMany.
+/// @note
+///   The bytes are accounted when each file is done, so a single huge
+///   file shows up all at once.
+struct BulkProgress
+{
+    size_t   filesDone;      ///< Files done, including the failed ones.
+    size_t   filesFailed;    ///< Files that failed.
+    size_t   filesTotal;     ///< Files of the batch.
+    uint64_t bytesDone;      ///< Size of the files done.
+    uint64_t bytesTotal;     ///< Size of all the files (stat'ed upfront).
+    double   bytesPerSecond; ///< bytesDone over the elapsed time.
+
+    std::chrono::milliseconds elapsed;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Receives the progress - Always called from the thread that called
+///   CopyMany / MoveMany, every kBulkProgressInterval and once more at
+///   the end - Must not throw.
+typedef std::function<void (const BulkProgress &)> BulkProgressCallback;
+
+
+//----------------------------------------------------------------------------//
+// Bulk Copy / Move                                                           //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Copies many files at once - Same as calling Copy for each job, but
+///   the jobs run on a pool of threads.
+///   The biggest files are started first, so a huge one doesn't end up
+///   alone at the end, and idle threads steal the jobs of the busy
+///   ones.
+/// @param jobs
+///   The files to copy - The destinations must be different.
+/// @param overwrite
+///   If true the destinations will be overwritten if they already exist.
+/// @param onProgress
+///   Receives the progress - May be empty.
+/// @param threads
+///   The number of threads - 0 means std::thread::hardware_concurrency.
+/// @returns
+///   The error message of each job (empty on success), in the same
+///   order of jobs - Failures don't throw nor stop the other jobs.
+/// @see Copy
+std::vector<std::string> CopyMany(
+    const std::vector<BulkJob> &jobs,
+    bool                        overwrite  = false,
+    BulkProgressCallback        onProgress = nullptr,
+    size_t                      threads    = 0);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Moves many files at once - Same as calling Move for each job (so
+///   the jobs across filesystems are copied and removed), but the jobs
+///   run on a pool of threads.
+/// @param jobs
+///   The files to move - The destinations must be different.
+/// @param overwrite
+///   If true the destinations will be overwritten if they already exist.
+/// @param onProgress
+///   Receives the progress - May be empty.
+/// @param threads
+///   The number of threads - 0 means std::thread::hardware_concurrency.
+/// @returns
+///   The error message of each job (empty on success), in the same
+///   order of jobs - Failures don't throw nor stop the other jobs.
+/// @see Move
+std::vector<std::string> MoveMany(
+    const std::vector<BulkJob> &jobs,
+    bool                        overwrite  = false,
+    BulkProgressCallback        onProgress = nullptr,
+    size_t                      threads    = 0);
+
+NS_COREFILE_END
@@ -0,0 +1,157 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Compression.h                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <string>
+#include <vector>
+// CoreFile
+#include "Config.h"
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   If zstd was compiled in - Turned on by the COREFILE_ZSTD CMake
+///   option, that links with the system libzstd.
+constexpr bool kZstdEnabled = (COREFILE_ZSTD != 0);
+
+///-----------------------------------------------------------------------------
+/// @brief The formats understood by the *Compressed functions.
+enum class Compression
+{
+    None, ///< Plain file.
+    Lz4,  ///< LZ4 frame format (the one of the lz4 command line tool).
+    Zstd  ///< Zstandard frame format - Needs kZstdEnabled.
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Size of the blocks of the LZ4 frames written - Each one is
+///   compressed by its own thread.
+constexpr size_t kLz4BlockSize = 4 * 1024 * 1024;
+
+
+//----------------------------------------------------------------------------//
+// Detect                                                                     //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   The format of the data, by its magic number - None if it isn't
+///   a LZ4 / zstd frame (skippable frames are ignored).
+Compression DetectCompression(const void *pData, size_t size);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The format of the file, by the magic number of its first bytes.
+/// @returns None if the file doesn't exist.
+Compression DetectCompression(const std::string &filename);
+
+
+//----------------------------------------------------------------------------//
+// Read                                                                       //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same of ReadAllBytes, but LZ4 / zstd files are decompressed - The
+///   format is detected by the magic number, so plain files are read
+///   as they are.
+/// @note
+///   The file is decompressed while it's read, in chunks, so the
+///   compressed contents are never fully in memory. Concatenated frames
+///   (i.e. from cat a.lz4 b.lz4) are decompressed one after the other.
+/// @throws
+///   std::runtime_error on read errors, corrupted frames or zstd files
+///   when kZstdEnabled is false.
+/// @see ReadAllBytes, DetectCompression
+std::vector<byte_t> ReadAllBytesDecompressed(const std::string &filename);
+
+///-----------------------------------------------------------------------------
+/// @brief Same of ReadAllLines, but compressed files are decompressed.
+/// @see ReadAllBytesDecompressed
+std::vector<std::string> ReadAllLinesDecompressed(const std::string &filename);
+
+///-----------------------------------------------------------------------------
+/// @brief Same of ReadAllText, but compressed files are decompressed.
+/// @see ReadAllBytesDecompressed
+std::string ReadAllTextDecompressed(const std::string &filename);
+
+
+//----------------------------------------------------------------------------//
+// Write                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same of WriteAllBytes, but the file is compressed first.
+/// @param compression
+///   The format of the file.
+/// @param threads
+///   The number of threads compressing - 0 means hardware_concurrency.
+///   LZ4 compresses each kLz4BlockSize block in parallel, zstd uses its
+///   own workers. Small payloads always use the calling thread.
+/// @throws
+///   std::invalid_argument if compression is Zstd and kZstdEnabled is
+///   false, std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on write errors.
+/// @note
+///   LZ4 frames are written with independent blocks, the content size
+///   and the content checksum - Readable by lz4(1).
+/// @see WriteAllBytes, ReadAllBytesDecompressed
+void WriteAllBytesCompressed(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    Compression        compression = Compression::Lz4,
+    size_t             threads     = 0,
+    WriteMode          mode        = WriteMode::Truncate,
+    Durability         durability  = Durability::None);
+
+///-----------------------------------------------------------------------------
+/// @brief Same of WriteAllLines, but the file is compressed first.
+/// @see WriteAllBytesCompressed
+void WriteAllLinesCompressed(
+    const std::string              &filename,
+    const std::vector<std::string> &lines,
+    Compression                     compression = Compression::Lz4,
+    size_t                          threads     = 0,
+    WriteMode                       mode        = WriteMode::Truncate,
+    Durability                      durability  = Durability::None);
+
+///-----------------------------------------------------------------------------
+/// @brief Same of WriteAllText, but the file is compressed first.
+/// @see WriteAllBytesCompressed
+void WriteAllTextCompressed(
+    const std::string &filename,
+    const std::string &contents,
+    Compression        compression = Compression::Lz4,
+    size_t             threads     = 0,
+    WriteMode          mode        = WriteMode::Truncate,
+    Durability         durability  = Durability::None);
+
+NS_COREFILE_END
@@ -1 +1,18 @@
 #pragma once
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   If the I/O instrumentation (counters and latency histograms of
+///   Instrumentation.h) is compiled in - Off by default, turned on by
+///   the COREFILE_INSTRUMENTATION CMake option.
+#if !defined(COREFILE_INSTRUMENTATION)
+    #define COREFILE_INSTRUMENTATION 0
+#endif
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   If zstd support (Compression.h) is compiled in - Off by default,
+///   turned on by the COREFILE_ZSTD CMake option.
+#if !defined(COREFILE_ZSTD)
+    #define COREFILE_ZSTD 0
+#endif
@@ -69,8 +69,48 @@ namespace FileMode
         constexpr auto kAppend          = "ab";
         constexpr auto kAppend_Truncate = "a+b";
     }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Binary modes that bypass the page cache (O_DIRECT).
+    ///   Buffers, offsets and sizes must be aligned to the device block
+    ///   size - @see AlignedBufferPool.
+    /// @note
+    ///   Only accepted by the file descriptor based APIs (AsyncFile...),
+    ///   std::fstream can't bypass the page cache so Open() rejects them.
+    namespace Direct {
+        constexpr auto kRead  = "rd";
+        constexpr auto kWrite = "wd";
+
+        constexpr auto kReadWrite_Open     = "r+d";
+        constexpr auto kReadWrite_Truncate = "w+d";
+    }
 }
 
+///-----------------------------------------------------------------------------
+/// @brief How the WriteAll* functions replace the contents of the file.
+enum class WriteMode
+{
+    /// The target is truncated and written in place.
+    /// A crash in the middle leaves a partially written file.
+    Truncate,
+
+    /// The contents are written to a temporary file in the same
+    /// directory that is then renamed over the target.
+    /// Readers see either the old or the new contents, never a mix.
+    Atomic
+};
+
+///-----------------------------------------------------------------------------
+/// @brief How much the WriteAll* functions flush before returning.
+enum class Durability
+{
+    None, ///< Nothing is flushed - Data is in the page cache only.
+    Data, ///< The file contents are flushed with fdatasync(2).
+    Full  ///< The file is flushed with fsync(2) as well as its directory,
+          ///< so the (new) directory entry survives a crash too.
+};
+
 
 //----------------------------------------------------------------------------//
 // Append                                                                     //
@@ -114,6 +154,15 @@ void AppendAllText(const std::string &filename, const std::string &contents);
 ///   The destination file.
 /// @param overwrite
 ///   If true destination will be overwritten if it already exists.
+/// @note
+///   The contents are streamed by the kernel (reflink, copy_file_range(2)
+///   or sendfile(2)) whenever possible, falling back to a fixed size
+///   buffer - The file is never loaded entirely into memory.
+/// @throws
+///   std::ios::failure if src can't be opened or if dst exists and
+///   overwrite is false. std::invalid_argument if src and dst are the
+///   same file.
+/// @see CopyMany
 void Copy(
     const std::string &src,
     const std::string &dst,
@@ -152,6 +201,8 @@ std::unique_ptr<std::fstream> CreateText(const std::string &filename);
 ///   Deletes the specified file.
 /// @param filename
 ///   The file name that will be deleted.
+/// @note
+///   Nothing happens if the file doesn't exist or can't be deleted.
 void Delete(const std::string &filename);
 
 
@@ -244,6 +295,13 @@ tm_t GetLastWriteTimeUtc(const std::string &filename);
 ///   The destination filename.
 /// @param overwrite
 ///   If true destination will be overwritten if it already exists.
+/// @note
+///   Across filesystems (where rename(2) fails with EXDEV) the file is
+///   copied, keeping its permissions and times, and then removed.
+/// @throws
+///   std::ios::failure if dst exists and overwrite is false (or if src
+///   can't be opened when copying) and std::runtime_error on errors.
+/// @see MoveMany
 void Move(
     const std::string &src,
     const std::string &dst,
@@ -333,8 +391,32 @@ std::vector<std::string> ReadAllLines(const std::string &filename);
 std::string ReadAllText(const std::string &filename);
 
 
-//COWTODO(n2omatt): Check how to implement that....
-//Replace(const std::string &filename, const std::string &filename, const std::string &filename, Boolean) ???
+//----------------------------------------------------------------------------//
+// Replace                                                                    //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Replaces the contents of the destination file with the source file,
+///   deleting the source and optionally creating a backup of the
+///   replaced file.
+/// @param src
+///   The file that replaces dst - It doesn't exist after the call.
+/// @param dst
+///   The file being replaced.
+/// @param backup
+///   Name of the backup of dst - Empty means no backup.
+/// @note
+///   dst is replaced atomically with rename(2) and the directory is
+///   flushed, so after a crash dst has either the old or new contents.
+///   src and dst must be on the same filesystem.
+///   Goes through the current backend - Other backends may not be
+///   atomic (@see Backend::ReplaceFile).
+/// @throws
+///   std::runtime_error if src or dst doesn't exist or if any step fails.
+void Replace(
+    const std::string &src,
+    const std::string &dst,
+    const std::string &backup = "");
 
 
 //----------------------------------------------------------------------------//
@@ -348,6 +430,12 @@ std::string ReadAllText(const std::string &filename);
 /// @param dateTime
 ///   The desired date time.
 /// @see time_t
+/// @throws
+///   std::runtime_error always - Linux has no way to set the
+///   creation time (nor the status change time of GetCreationTime).
+/// @warning
+///   Behavior change - It used to silently do nothing, so callers
+///   that relied on that must catch the exception (or skip the call).
 void SetCreationTime(const std::string &filename, time_t dateTime);
 
 ///-----------------------------------------------------------------------------
@@ -359,6 +447,9 @@ void SetCreationTime(const std::string &filename, time_t dateTime);
 /// @param dateTime
 ///   The desired date time.
 /// @see time_t
+/// @throws
+///   std::runtime_error always - Same of SetCreationTime (that used
+///   to silently do nothing too).
 void SetCreationTimeUtc(const std::string &filename, time_t dateTime);
 
 
@@ -369,7 +460,9 @@ void SetCreationTimeUtc(const std::string &filename, time_t dateTime);
 ///   The name of target file.
 /// @param dateTime
 ///   The desired date time.
-/// @see time_t
+/// @see time_t, SetFileTimes
+/// @throws
+///   std::runtime_error if the time couldn't be set.
 void SetLastAccessTime(const std::string &filename, time_t dateTime);
 
 ///-----------------------------------------------------------------------------
@@ -380,7 +473,9 @@ void SetLastAccessTime(const std::string &filename, time_t dateTime);
 ///   The name of target file.
 /// @param dateTime
 ///   The desired date time.
-/// @see time_t
+/// @see time_t, SetFileTimes
+/// @throws
+///   std::runtime_error if the time couldn't be set.
 void SetLastAccessTimeUtc(const std::string &filename, time_t dateTime);
 
 
@@ -391,7 +486,9 @@ void SetLastAccessTimeUtc(const std::string &filename, time_t dateTime);
 ///   The name of target file.
 /// @param dateTime
 ///   The desired date time.
-/// @see time_t
+/// @see time_t, SetFileTimes
+/// @throws
+///   std::runtime_error if the time couldn't be set.
 void SetLastWriteTime(const std::string &filename, time_t dateTime);
 
 ///-----------------------------------------------------------------------------
@@ -402,7 +499,9 @@ void SetLastWriteTime(const std::string &filename, time_t dateTime);
 ///   The name of target file.
 /// @param dateTime
 ///   The desired date time.
-/// @see time_t
+/// @see time_t, SetFileTimes
+/// @throws
+///   std::runtime_error if the time couldn't be set.
 void SetLastWriteTimeUtc(const std::string &filename, time_t dateTime);
 
 
@@ -440,10 +539,38 @@ size_t GetSize(std::fstream &fileStream);
 ///   The name of the file that will be written.
 /// @param bytes
 ///   The list of bytes that will be written.
-/// @see byte_t.
+/// @param mode
+///   Truncate in place or replace atomically.
+/// @param durability
+///   How much is flushed to disk before returning.
+/// @see byte_t, WriteMode, Durability.
 void WriteAllBytes(
     const std::string         &filename,
-    const std::vector<byte_t> &bytes);
+    const std::vector<byte_t> &bytes,
+    WriteMode                  mode       = WriteMode::Truncate,
+    Durability                 durability = Durability::None);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Creates a new file, writes the specified buffer to the file,
+///   and then closes the file. If the target file already exists,
+///   it is overwritten.
+/// @param filename
+///   The name of the file that will be written.
+/// @param pData
+///   Pointer to the bytes that will be written.
+/// @param size
+///   The number of bytes that will be written.
+/// @note
+///   The buffer is written with a single write(2) call (or a few large
+///   chunks for huge buffers) - Callers don't need to build a vector first.
+/// @see WriteMode, Durability.
+void WriteAllBytes(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    WriteMode          mode       = WriteMode::Truncate,
+    Durability         durability = Durability::None);
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -453,9 +580,16 @@ void WriteAllBytes(
 ///   The name of the file that will be written.
 /// @param lines
 ///   The list of lines that will be written.
+/// @param mode
+///   Truncate in place or replace atomically.
+/// @param durability
+///   How much is flushed to disk before returning.
+/// @see WriteMode, Durability.
 void WriteAllLines(
     const std::string              &filename,
-    const std::vector<std::string> &lines);
+    const std::vector<std::string> &lines,
+    WriteMode                       mode       = WriteMode::Truncate,
+    Durability                      durability = Durability::None);
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -466,8 +600,35 @@ void WriteAllLines(
 ///   The name of the file that will be written.
 /// @param contents
 ///   The text that will be written.
+/// @param mode
+///   Truncate in place or replace atomically.
+/// @param durability
+///   How much is flushed to disk before returning.
+/// @see WriteMode, Durability.
+void WriteAllText(
+    const std::string &filename,
+    const std::string &contents,
+    WriteMode          mode       = WriteMode::Truncate,
+    Durability         durability = Durability::None);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Creates a new file, writes the specified characters to the file,
+///   and then closes the file. If the target file already exists,
+///   it is overwritten.
+/// @param filename
+///   The name of the file that will be written.
+/// @param pContents
+///   Pointer to the text that will be written - Doesn't need to be
+///   null terminated.
+/// @param size
+///   The number of chars that will be written.
+/// @see WriteMode, Durability.
 void WriteAllText(
     const std::string &filename,
-    const std::string &contents);
+    const char        *pContents,
+    size_t             size,
+    WriteMode          mode       = WriteMode::Truncate,
+    Durability         durability = Durability::None);
 
 NS_COREFILE_END
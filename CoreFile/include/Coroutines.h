@@ -0,0 +1,625 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Coroutines.h                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    C++20 coroutine versions of the ReadAll* / WriteAll* functions.         //
+//    Everything here is header only and is only available when the          //
+//    including translation unit is compiled as C++20 - The library itself   //
+//    keeps building as C++11.                                                //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+    #define COW_COREFILE_HAS_COROUTINES 1
+#endif
+#endif
+
+#if defined(COW_COREFILE_HAS_COROUTINES)
+
+// std
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+#include "AsyncFile.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Executor                                                                   //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Minimal thread pool that resumes coroutines.
+///   Completed I/O operations are handed to it, so user code never runs
+///   on the AsyncIO internal threads.
+class Executor
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param threads
+    ///   Number of threads - 0 means std::thread::hardware_concurrency.
+    explicit Executor(size_t threads = 0) :
+        m_stopping(false)
+    {
+        if(threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        for(size_t i = 0; i < threads; ++i)
+            m_threads.emplace_back([this]() { WorkerLoop(); });
+    }
+
+    ~Executor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_cond.notify_all();
+
+        for(auto &thread : m_threads)
+            thread.join();
+    }
+
+    Executor(const Executor &)            = delete;
+    Executor& operator =(const Executor &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Process wide executor.
+    static Executor& GetDefault()
+    {
+        static Executor s_executor;
+        return s_executor;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Queues the coroutine to be resumed by one of the threads.
+    void Post(std::coroutine_handle<> handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back(handle);
+        }
+        m_cond.notify_one();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Awaitable that moves the awaiting coroutine to this executor.
+    ///   co_await executor.Schedule();
+    auto Schedule()
+    {
+        struct Awaiter
+        {
+            Executor *pExecutor;
+
+            bool await_ready  () const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> h) { pExecutor->Post(h); }
+            void await_resume () const noexcept {}
+        };
+
+        return Awaiter{ this };
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void WorkerLoop()
+    {
+        while(true)
+        {
+            std::coroutine_handle<> handle;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cond.wait(lock, [this]() {
+                    return m_stopping || !m_queue.empty();
+                });
+
+                if(m_queue.empty())
+                    return;
+
+                handle = m_queue.front();
+                m_queue.pop_front();
+            }
+
+            handle.resume();
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::mutex                          m_mutex;
+    std::condition_variable             m_cond;
+    std::deque<std::coroutine_handle<>> m_queue;
+    std::vector<std::thread>            m_threads;
+    bool                                m_stopping;
+};
+
+
+//----------------------------------------------------------------------------//
+// Task                                                                       //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Lazy coroutine that produces a T.
+///   It starts when awaited and resumes the awaiter when done.
+/// @see SyncWait
+template <typename T>
+class Task
+{
+public:
+    struct PromiseBase
+    {
+        std::coroutine_handle<> continuation;
+        std::exception_ptr      pException;
+
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            template <typename P>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+            {
+                auto continuation = h.promise().continuation;
+                return (continuation) ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter        final_suspend  () noexcept { return {}; }
+
+        void unhandled_exception() { pException = std::current_exception(); }
+    };
+
+    struct PromiseValue : PromiseBase
+    {
+        T value;
+
+        template <typename U>
+        void return_value(U &&v) { value = std::forward<U>(v); }
+
+        T Result()
+        {
+            if(this->pException)
+                std::rethrow_exception(this->pException);
+            return std::move(value);
+        }
+    };
+
+    struct PromiseVoid : PromiseBase
+    {
+        void return_void() {}
+
+        void Result()
+        {
+            if(this->pException)
+                std::rethrow_exception(this->pException);
+        }
+    };
+
+    struct promise_type :
+        std::conditional_t<std::is_void_v<T>, PromiseVoid, PromiseValue>
+    {
+        Task get_return_object()
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+
+public:
+    Task(Task &&other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    ~Task() { if(m_handle) m_handle.destroy(); }
+
+    Task(const Task &)            = delete;
+    Task& operator =(const Task &) = delete;
+
+    bool await_ready() const noexcept { return !m_handle || m_handle.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+    {
+        m_handle.promise().continuation = awaiter;
+        return m_handle;
+    }
+
+    T await_resume() { return m_handle.promise().Result(); }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+
+//----------------------------------------------------------------------------//
+// AsyncGenerator                                                             //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Coroutine that yields many values and may co_await between them.
+///   Usage:
+///     auto gen = ReadLinesAsync(path);
+///     while(co_await gen.Next())
+///         use(gen.Value());
+template <typename T>
+class AsyncGenerator
+{
+public:
+    struct promise_type
+    {
+        T                       current;
+        std::coroutine_handle<> consumer;
+        std::exception_ptr      pException;
+
+        struct YieldAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+            {
+                return h.promise().consumer;
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        AsyncGenerator get_return_object()
+        {
+            return AsyncGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        YieldAwaiter        final_suspend  () noexcept { return {}; }
+
+        template <typename U>
+        YieldAwaiter yield_value(U &&value)
+        {
+            current = std::forward<U>(value);
+            return {};
+        }
+
+        void return_void() {}
+        void unhandled_exception() { pException = std::current_exception(); }
+    };
+
+public:
+    AsyncGenerator(AsyncGenerator &&other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+    ~AsyncGenerator() { if(m_handle) m_handle.destroy(); }
+
+    AsyncGenerator(const AsyncGenerator &)            = delete;
+    AsyncGenerator& operator =(const AsyncGenerator &) = delete;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Awaitable that produces the next value.
+    ///   Resumes with false when the generator is exhausted.
+    auto Next()
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept { return handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept
+            {
+                handle.promise().consumer = consumer;
+                return handle;
+            }
+
+            bool await_resume()
+            {
+                if(handle.promise().pException)
+                    std::rethrow_exception(handle.promise().pException);
+                return !handle.done();
+            }
+        };
+
+        return Awaiter{ m_handle };
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The last value yielded - Valid until the next call of Next.
+    const T& Value() const { return m_handle.promise().current; }
+
+private:
+    explicit AsyncGenerator(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+
+//----------------------------------------------------------------------------//
+// Awaitables                                                                 //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Awaitable positioned read / write on an AsyncFile.
+///   The awaiting coroutine is resumed on the executor.
+/// @returns (co_await) the number of bytes transferred.
+/// @throws std::runtime_error if the operation fails.
+class AsyncFileAwaitable
+{
+public:
+    AsyncFileAwaitable(
+        AsyncFile            &file,
+        AsyncOperation::Type  type,
+        void                 *pBuffer,
+        size_t                size,
+        uint64_t              offset,
+        Executor             &executor = Executor::GetDefault()) :
+        m_pFile    (&file),
+        m_pExecutor(&executor),
+        m_op       { type, file.GetFd(), pBuffer, size, offset, nullptr },
+        m_error    (0),
+        m_bytes    (0)
+    {
+        // Empty...
+    }
+
+    bool await_ready() const noexcept { return m_op.size == 0; }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_op.callback = [this, handle](int error, size_t bytes) {
+            m_error = error;
+            m_bytes = bytes;
+            m_pExecutor->Post(handle);
+        };
+        m_pFile->GetIO().Submit(m_op);
+    }
+
+    size_t await_resume() const
+    {
+        if(m_error != 0)
+        {
+            throw std::runtime_error(
+                "Failed async I/O - filename: (" + m_pFile->GetFilename()
+                + ") - error: (" + strerror(m_error) + ")"
+            );
+        }
+        return m_bytes;
+    }
+
+private:
+    AsyncFile      *m_pFile;
+    Executor       *m_pExecutor;
+    AsyncOperation  m_op;
+    int             m_error;
+    size_t          m_bytes;
+};
+
+
+//----------------------------------------------------------------------------//
+// Read                                                                       //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Coroutine version of ReadAllBytes.
+/// @note
+///   Opening the file is synchronous, the read is asynchronous.
+/// @warning
+///   Unlike ReadAllBytes, which returns an empty vector, a missing (or
+///   unreadable) file makes the co_await throw std::ios::failure.
+/// @throws
+///   std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on read errors.
+/// @see ReadAllBytes
+inline Task<std::vector<byte_t>> ReadAllBytesAsync(std::string filename)
+{
+    AsyncFile file(filename, FileMode::Binary::kRead);
+
+    std::vector<byte_t> bytes(file.GetSize());
+    auto read = co_await AsyncFileAwaitable(
+        file, AsyncOperation::Type::Read, bytes.data(), bytes.size(), 0
+    );
+    bytes.resize(read);
+
+    co_return bytes;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Coroutine version of ReadAllText.
+/// @warning
+///   Unlike ReadAllText, which returns an empty string, a missing (or
+///   unreadable) file makes the co_await throw std::ios::failure.
+/// @throws
+///   std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on read errors.
+/// @see ReadAllText
+inline Task<std::string> ReadAllTextAsync(std::string filename)
+{
+    AsyncFile file(filename, FileMode::Text::kRead);
+
+    std::string text(file.GetSize(), '\0');
+    auto read = co_await AsyncFileAwaitable(
+        file, AsyncOperation::Type::Read, text.data(), text.size(), 0
+    );
+    text.resize(read);
+
+    co_return text;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Asynchronous line reader - Same line rules of LineReader.
+///   The yielded views are valid until the next call of Next.
+/// @param blockSize
+///   Size of each asynchronous read.
+/// @see LineReader
+inline AsyncGenerator<std::string_view> ReadLinesAsync(
+    std::string filename,
+    size_t      blockSize = 1024 * 1024)
+{
+    AsyncFile file(filename, FileMode::Text::kRead);
+
+    std::vector<char> buffer(std::max<size_t>(blockSize, 1));
+    size_t   begin  = 0; // Start of the unread data.
+    size_t   end    = 0; // End of the valid data.
+    uint64_t offset = 0; // File offset of the next read.
+
+    while(true)
+    {
+        // Yield all the complete lines in the buffer.
+        while(auto p_nl = static_cast<char *>(memchr(buffer.data() + begin, '\n', end - begin)))
+        {
+            auto nl = static_cast<size_t>(p_nl - buffer.data());
+            co_yield std::string_view(buffer.data() + begin, nl - begin);
+            begin = nl + 1;
+        }
+
+        // Keep the partial line and make room for more data.
+        std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+        end  -= begin;
+        begin = 0;
+        if(end == buffer.size())
+            buffer.resize(buffer.size() * 2);
+
+        auto read = co_await AsyncFileAwaitable(
+            file,
+            AsyncOperation::Type::Read,
+            buffer.data() + end,
+            buffer.size() - end,
+            offset
+        );
+
+        if(read == 0)
+            break;
+
+        end    += read;
+        offset += read;
+    }
+
+    // Last line without the trailing '\n'.
+    if(end > begin)
+        co_yield std::string_view(buffer.data() + begin, end - begin);
+}
+
+
+//----------------------------------------------------------------------------//
+// Write                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Coroutine version of WriteAllBytes.
+/// @see WriteAllBytes
+inline Task<void> WriteAllBytesAsync(
+    std::string         filename,
+    std::vector<byte_t> bytes)
+{
+    AsyncFile file(filename, FileMode::Binary::kWrite);
+    co_await AsyncFileAwaitable(
+        file, AsyncOperation::Type::Write, bytes.data(), bytes.size(), 0
+    );
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Coroutine version of WriteAllText.
+/// @see WriteAllText
+inline Task<void> WriteAllTextAsync(
+    std::string filename,
+    std::string contents)
+{
+    AsyncFile file(filename, FileMode::Text::kWrite);
+    co_await AsyncFileAwaitable(
+        file, AsyncOperation::Type::Write, contents.data(), contents.size(), 0
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// SyncWait                                                                   //
+//----------------------------------------------------------------------------//
+namespace Private {
+    // Coroutine that starts immediately and frees itself when done.
+    struct DetachedTask
+    {
+        struct promise_type
+        {
+            DetachedTask        get_return_object  () noexcept { return {}; }
+            std::suspend_never  initial_suspend    () noexcept { return {}; }
+            std::suspend_never  final_suspend      () noexcept { return {}; }
+            void                return_void        () noexcept {}
+            void                unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    template <typename T>
+    DetachedTask run_to_promise(Task<T> task, std::promise<T> &promise)
+    {
+        try {
+            if constexpr(std::is_void_v<T>) {
+                co_await task;
+                promise.set_value();
+            } else {
+                promise.set_value(co_await task);
+            }
+        } catch(...) {
+            promise.set_exception(std::current_exception());
+        }
+    }
+} // namespace Private
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Blocks the calling thread until the task completes.
+///   Useful to call the coroutine API from synchronous code.
+/// @returns The task result - Exceptions are rethrown.
+template <typename T>
+T SyncWait(Task<T> task)
+{
+    std::promise<T> promise;
+    auto future = promise.get_future();
+
+    Private::run_to_promise(std::move(task), promise);
+    return future.get();
+}
+
+NS_COREFILE_END
+
+#endif // COW_COREFILE_HAS_COROUTINES
@@ -0,0 +1,280 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DirectIO.h                                                    //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+#include "ParallelRead.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Default alignment of the Direct I/O buffers.
+///   Covers the logical block size of every common device (512 / 4096).
+constexpr size_t kDirectIOAlignment = 4096;
+
+///-----------------------------------------------------------------------------
+/// @brief Default size of the buffers handed by the AlignedBufferPool.
+constexpr size_t kDirectIODefaultBufferSize = 1024 * 1024;
+
+
+// Forward declarations.
+class AlignedBufferPool;
+
+//----------------------------------------------------------------------------//
+// AlignedBuffer                                                              //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Memory block aligned to the Direct I/O requirements.
+///   Acquired from an AlignedBufferPool and given back to it when the
+///   object is destroyed.
+/// @note
+///   AlignedBuffer is move-only.
+///   The pool must outlive every buffer acquired from it.
+class AlignedBuffer
+{
+    friend class AlignedBufferPool;
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    AlignedBuffer();
+    ~AlignedBuffer();
+
+    AlignedBuffer(AlignedBuffer &&other);
+    AlignedBuffer& operator =(AlignedBuffer &&other);
+
+    AlignedBuffer(const AlignedBuffer &)            = delete;
+    AlignedBuffer& operator =(const AlignedBuffer &) = delete;
+
+private:
+    AlignedBuffer(AlignedBufferPool *pPool, byte_t *pData, size_t size);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Pointer to the first byte - nullptr if the buffer is empty.
+    byte_t*       Data()       { return m_pData; }
+    const byte_t* Data() const { return m_pData; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The size of the buffer in bytes.
+    size_t Size() const { return m_size; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gives the buffer back to its pool right away.
+    void Release();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    AlignedBufferPool *m_pPool;
+    byte_t            *m_pData;
+    size_t             m_size;
+};
+
+
+//----------------------------------------------------------------------------//
+// AlignedBufferPool                                                          //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Thread safe pool of equally sized, aligned buffers.
+///   Direct I/O needs aligned memory for every transfer - Reusing the
+///   buffers avoids paying posix_memalign(3) and the page faults of
+///   fresh memory on every read / write.
+class AlignedBufferPool
+{
+    friend class AlignedBuffer;
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Creates the pool - No memory is allocated until Acquire.
+    /// @param bufferSize
+    ///   The size of each buffer - Rounded up to the alignment.
+    /// @param alignment
+    ///   The alignment of each buffer - Must be a power of two.
+    /// @param maxCached
+    ///   How many released buffers are kept for reuse, the exceeding
+    ///   ones are freed.
+    /// @throws
+    ///   std::invalid_argument if alignment isn't a power of two or if
+    ///   bufferSize is 0.
+    explicit AlignedBufferPool(
+        size_t bufferSize = kDirectIODefaultBufferSize,
+        size_t alignment  = kDirectIOAlignment,
+        size_t maxCached  = 16);
+
+    ~AlignedBufferPool();
+
+    AlignedBufferPool(const AlignedBufferPool &)            = delete;
+    AlignedBufferPool& operator =(const AlignedBufferPool &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The process wide pool used by the *Direct functions.
+    static AlignedBufferPool& GetDefault();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets a buffer, reusing a released one when possible.
+    /// @throws std::bad_alloc if the memory couldn't be allocated.
+    AlignedBuffer Acquire();
+
+    size_t GetBufferSize() const { return m_bufferSize; }
+    size_t GetAlignment () const { return m_alignment;  }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void Give(byte_t *pData);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    size_t m_bufferSize;
+    size_t m_alignment;
+    size_t m_maxCached;
+
+    std::mutex            m_mutex;
+    std::vector<byte_t *> m_free;
+};
+
+
+//----------------------------------------------------------------------------//
+// Direct I/O                                                                 //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Reads the whole file bypassing the page cache (O_DIRECT).
+///   Meant for large, read once files (backups, bulk loads) that would
+///   otherwise evict the useful pages of the cache.
+/// @param filename
+///   The name of the file that will be read.
+/// @param pool
+///   The pool that provides the aligned transfer buffers.
+/// @returns
+///   A vector of bytes - Same result of ReadAllBytes.
+/// @note
+///   If the filesystem doesn't support O_DIRECT (tmpfs...) the file is
+///   read with buffered I/O and its pages are dropped from the cache
+///   afterwards (posix_fadvise(2) DONTNEED).
+/// @throws
+///   std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on read errors.
+/// @see ReadAllBytes, ReadDirect
+std::vector<byte_t> ReadAllBytesDirect(
+    const std::string &filename,
+    AlignedBufferPool &pool = AlignedBufferPool::GetDefault());
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Streams the file bypassing the page cache, handing each buffer
+///   to the callback - Nothing is copied besides the device transfer.
+/// @param filename
+///   The name of the file that will be read.
+/// @param callback
+///   Receives the offset, the data and the size of each buffer,
+///   in file order.
+/// @param pool
+///   The pool that provides the aligned transfer buffers.
+/// @note
+///   Same O_DIRECT fallback of ReadAllBytesDirect.
+/// @throws
+///   std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on read errors.
+void ReadDirect(
+    const std::string   &filename,
+    const ChunkCallback &callback,
+    AlignedBufferPool   &pool = AlignedBufferPool::GetDefault());
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Creates (or truncates) the file and writes the bytes bypassing
+///   the page cache (O_DIRECT).
+/// @param filename
+///   The name of the file that will be written.
+/// @param pData
+///   The bytes that will be written.
+/// @param size
+///   How many bytes will be written.
+/// @param pool
+///   The pool that provides the aligned transfer buffers.
+/// @note
+///   Direct I/O only transfers whole blocks, so a tail that isn't a
+///   multiple of the alignment is written zero padded and the file is
+///   truncated back to size afterwards.
+///   Same O_DIRECT fallback of ReadAllBytesDirect.
+/// @throws
+///   std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on write errors.
+/// @see WriteAllBytes
+void WriteAllBytesDirect(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    AlignedBufferPool &pool = AlignedBufferPool::GetDefault());
+
+void WriteAllBytesDirect(
+    const std::string         &filename,
+    const std::vector<byte_t> &bytes,
+    AlignedBufferPool         &pool = AlignedBufferPool::GetDefault());
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Drops the clean pages of the file from the page cache
+///   (posix_fadvise(2) DONTNEED), so the next read comes from the disk -
+///   Useful to measure cold cache reads.
+/// @note
+///   Dirty pages are kept - Sync the file first to drop all of them.
+/// @throws
+///   std::ios::failure if the file couldn't be opened.
+void DropFromPageCache(const std::string &filename);
+
+NS_COREFILE_END
@@ -0,0 +1,101 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Endian.h                                                      //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+// CoreFile
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Byte order of the values stored in a file.
+enum class Endian
+{
+    Little,
+    Big,
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    Native = Big    ///< Byte order of this machine.
+#else
+    Native = Little ///< Byte order of this machine.
+#endif
+};
+
+
+//----------------------------------------------------------------------------//
+// Functions                                                                  //
+//----------------------------------------------------------------------------//
+namespace Private {
+
+template <size_t Size> struct unsigned_of_size;
+template <> struct unsigned_of_size<1> { typedef uint8_t  type; };
+template <> struct unsigned_of_size<2> { typedef uint16_t type; };
+template <> struct unsigned_of_size<4> { typedef uint32_t type; };
+template <> struct unsigned_of_size<8> { typedef uint64_t type; };
+
+inline uint8_t  byte_swap(uint8_t  value) { return value;                    }
+inline uint16_t byte_swap(uint16_t value) { return __builtin_bswap16(value); }
+inline uint32_t byte_swap(uint32_t value) { return __builtin_bswap32(value); }
+inline uint64_t byte_swap(uint64_t value) { return __builtin_bswap64(value); }
+
+} // namespace Private
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Converts the value between the native byte order and Order.
+///   The conversion is symmetric, so it's used for both reading and
+///   writing - When Order is the native one it's a no-op that the
+///   compiler removes entirely.
+/// @tparam T
+///   An integer or floating point type up to 8 bytes.
+template <Endian Order, typename T>
+inline T ConvertEndian(T value)
+{
+    static_assert(
+        std::is_arithmetic<T>::value && sizeof(T) <= 8,
+        "ConvertEndian only works with integer and floating point types"
+    );
+
+    if(Order == Endian::Native)
+        return value;
+
+    // COWNOTE(n2omatt): memcpy is the only well defined way to get the
+    //   bits of a float - Compilers turn it into a register move.
+    typedef typename Private::unsigned_of_size<sizeof(T)>::type bits_t;
+
+    bits_t bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    bits = Private::byte_swap(bits);
+    std::memcpy(&value, &bits, sizeof(T));
+
+    return value;
+}
+
+NS_COREFILE_END
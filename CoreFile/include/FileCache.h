@@ -0,0 +1,169 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileCache.h                                                   //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+// Forward declarations.
+namespace Private { class FileCacheShard; }
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Read-through cache of whole file contents - Alternative to
+///   ReadAllText for files that are read over and over.
+///   By default each Get checks the freshness of the cached content with
+///   a single stat(2): the entry is only used if the device, inode, size
+///   and modification time (the same st_mtime of GetLastWriteTime, with
+///   nanoseconds) are still the same.
+/// @note
+///   Thread safe - The entries are spread in independently locked
+///   shards, each one with its part of the budget and its own LRU.
+///   The files are read outside of the locks.
+/// @see ReadAllText
+class FileCache
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Shared immutable contents - Stay valid after the entry is
+    ///   evicted or invalidated.
+    typedef std::shared_ptr<const std::string> Content;
+
+    ///-------------------------------------------------------------------------
+    /// @brief How the cached entries are checked for freshness.
+    enum class Validation
+    {
+        Stat, ///< A stat(2) on every Get.
+        None  ///< Never - The entries are trusted until Invalidate is
+              ///< called, i.e. by a FileWatcher.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief Snapshot of the cache counters.
+    struct Stats
+    {
+        uint64_t hits;          ///< Gets served from the cache.
+        uint64_t misses;        ///< Gets that read the file.
+        uint64_t evictions;     ///< Entries dropped to respect the budget.
+        uint64_t invalidations; ///< Entries dropped because they were stale.
+        size_t   entries;       ///< Entries currently cached.
+        size_t   bytes;         ///< Bytes currently cached.
+    };
+
+    static constexpr size_t kDefaultByteBudget = 64 * 1024 * 1024;
+    static constexpr size_t kDefaultShardCount = 16;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Creates an empty cache.
+    /// @param byteBudget
+    ///   Maximum number of cached bytes - Split evenly by the shards.
+    ///   Files bigger than the budget of a shard are never cached.
+    /// @param shardCount
+    ///   Number of independently locked shards - More shards means less
+    ///   contention between threads.
+    /// @param validation
+    ///   How the entries are checked for freshness.
+    /// @see FileWatcher::InvalidateCache
+    explicit FileCache(
+        size_t     byteBudget = kDefaultByteBudget,
+        size_t     shardCount = kDefaultShardCount,
+        Validation validation = Validation::Stat);
+
+    ~FileCache();
+
+    FileCache(const FileCache &)            = delete;
+    FileCache& operator =(const FileCache &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the contents of the file, reading it if needed.
+    /// @param filename
+    ///   The name of the file.
+    /// @returns
+    ///   The contents of the file - Empty if the file doesn't exist or
+    ///   isn't a regular file (same behavior of ReadAllText).
+    /// @throws
+    ///   std::runtime_error on read errors.
+    Content Get(const std::string &filename);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Drops the entry of the file - Does nothing if not cached.
+    /// @note
+    ///   A Get reading the file at the same time returns what it read
+    ///   but doesn't cache it, since it may be the old version.
+    void Invalidate(const std::string &filename);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Drops all the entries - The counters are kept.
+    void Clear();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the counters.
+    Stats GetStats() const;
+
+    size_t GetByteBudget() const { return m_byteBudget; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    Private::FileCacheShard& GetShard(const std::string &filename);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    size_t     m_byteBudget;
+    Validation m_validation;
+
+    std::vector<std::unique_ptr<Private::FileCacheShard>> m_shards;
+
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_misses;
+    std::atomic<uint64_t> m_evictions;
+    std::atomic<uint64_t> m_invalidations;
+};
+
+NS_COREFILE_END
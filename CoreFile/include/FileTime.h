@@ -0,0 +1,174 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileTime.h                                                    //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile.h"
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Time of a file, with the nanoseconds that the filesystem keeps.
+typedef std::chrono::time_point<
+    std::chrono::system_clock,
+    std::chrono::nanoseconds
+> FileTime;
+
+///-----------------------------------------------------------------------------
+/// @brief New times of a file - @see SetFileTimes.
+struct FileTimeUpdate
+{
+    std::string filename;
+
+    FileTime accessTime;
+    FileTime writeTime;
+
+    /// If false the respective time is kept as it is.
+    bool setAccessTime;
+    bool setWriteTime;
+};
+
+
+//----------------------------------------------------------------------------//
+// Conversions                                                                //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Converts the timespec (i.e. of FileMetadata) to a FileTime.
+FileTime ToFileTime(const struct timespec &time);
+
+///-----------------------------------------------------------------------------
+/// @brief Converts the FileTime back to a timespec.
+struct timespec ToTimespec(FileTime time);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Breaks the time down in the local timezone - Reentrant alternative
+///   to localtime(3).
+/// @note
+///   Thread safe and lock free for the common case: the UTC offsets are
+///   cached per thread in 15 minutes windows, so only the first time of
+///   each window goes to localtime_r(3) (and the glibc timezone lock).
+///   The times are assumed to not change the timezone of the process -
+///   @see ResetTimeZoneCache.
+tm_t ToLocalTime(time_t time);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Breaks the time down in UTC - Reentrant alternative to gmtime(3)
+///   that is pure arithmetic, so it never locks.
+tm_t ToUtcTime(time_t time);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Drops the cached UTC offsets of all the threads - Must be called
+///   after changing the timezone of the process (TZ + tzset(3)).
+void ResetTimeZoneCache();
+
+
+//----------------------------------------------------------------------------//
+// Get * Time                                                                 //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as GetCreationTime but keeps the nanoseconds and skips the
+///   timezone conversion.
+/// @note
+///   Like GetCreationTime it's the status change time (st_ctime) -
+///   @see FileMetadata::birthTime for the real creation time.
+/// @throws
+///   std::runtime_error if the file couldn't be stat'ed.
+FileTime GetCreationTimeNs(const std::string &filename);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as GetLastAccessTime but keeps the nanoseconds and skips the
+///   timezone conversion.
+/// @throws
+///   std::runtime_error if the file couldn't be stat'ed.
+FileTime GetLastAccessTimeNs(const std::string &filename);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as GetLastWriteTime but keeps the nanoseconds and skips the
+///   timezone conversion.
+/// @throws
+///   std::runtime_error if the file couldn't be stat'ed.
+FileTime GetLastWriteTimeNs(const std::string &filename);
+
+
+//----------------------------------------------------------------------------//
+// Set * Time                                                                 //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as SetLastAccessTime but with nanoseconds.
+/// @throws
+///   std::runtime_error if the time couldn't be set.
+void SetLastAccessTimeNs(const std::string &filename, FileTime time);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as SetLastWriteTime but with nanoseconds.
+/// @throws
+///   std::runtime_error if the time couldn't be set.
+void SetLastWriteTimeNs(const std::string &filename, FileTime time);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Sets both the access and the write times with a single
+///   utimensat(2).
+/// @throws
+///   std::runtime_error if the times couldn't be set.
+void SetFileTimes(
+    const std::string &filename,
+    FileTime           accessTime,
+    FileTime           writeTime);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Sets the times of many files at once - The utimensat(2) calls are
+///   spread over a pool of threads.
+/// @param updates
+///   The files and their new times.
+/// @param threads
+///   The number of threads - 0 means std::thread::hardware_concurrency.
+///   Small batches are done on the calling thread.
+/// @param followSymlinks
+///   If false the times are of the symlinks themselves.
+/// @returns
+///   The errno of each update (0 on success), in the same order of
+///   updates - Failures don't throw.
+std::vector<int> SetFileTimes(
+    const std::vector<FileTimeUpdate> &updates,
+    size_t                             threads        = 0,
+    bool                               followSymlinks = true);
+
+NS_COREFILE_END
@@ -0,0 +1,235 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileWatcher.h                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "FileCache.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Watches files for changes with inotify(7) - Alternative to polling
+///   GetLastWriteTime.
+///   The events of each file are coalesced and only delivered after
+///   the file is quiet for the debounce interval, so a burst of writes
+///   gives a single callback.
+/// @note
+///   The parent directories are watched instead of the files, so the
+///   files don't need to exist and atomic replaces (a rename over the
+///   file, i.e. WriteMode::Atomic and Replace) are seen as well.
+///
+///   The events can be processed by:
+///     - A background thread - @see Start.
+///     - The caller's own event loop - @see GetFd, Process, GetTimeout.
+///   Only one of them should be used at time.
+///
+///   When a watched directory is removed (or moved away) its watch is
+///   kept and re-armed once the directory is back at the same path -
+///   Meanwhile GetTimeout wakes the caller every kRearmInterval to
+///   retry, and the files found there on re-arm are delivered as
+///   Created (their events in between were lost).
+/// @see FileCache
+class FileWatcher
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief What happened to the file.
+    /// @note
+    ///   When many events are coalesced the last one is delivered,
+    ///   except that Modified never hides a Created.
+    enum class Event
+    {
+        Modified, ///< The contents or the attributes changed.
+        Created,  ///< The file was created or moved / renamed to the path.
+        Moved,    ///< The file was moved / renamed away from the path.
+        Deleted   ///< The file was deleted.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Receives the watched filename (exactly as it was given to
+    ///   Watch) and what happened to it - Must not throw.
+    typedef std::function<void (const std::string &, Event)> Callback;
+
+    static constexpr std::chrono::milliseconds kDefaultDebounce =
+        std::chrono::milliseconds(50);
+
+    static constexpr std::chrono::milliseconds kRearmInterval =
+        std::chrono::milliseconds(100);
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Creates the watcher - Nothing is watched yet.
+    /// @param callback
+    ///   Called for each (coalesced) event.
+    /// @param debounce
+    ///   How long a file must be quiet before its event is delivered -
+    ///   Zero delivers the events as soon as they are processed.
+    /// @throws
+    ///   std::runtime_error if the inotify instance couldn't be created.
+    explicit FileWatcher(
+        Callback                  callback,
+        std::chrono::milliseconds debounce = kDefaultDebounce);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Stops the background thread (if any) and the watches.
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher &)            = delete;
+    FileWatcher& operator =(const FileWatcher &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Watches                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Starts watching the file - Watching it again does nothing.
+    /// @throws
+    ///   std::runtime_error if the parent directory couldn't be watched.
+    void Watch(const std::string &filename);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Stops watching the file - Pending events are dropped.
+    void Unwatch(const std::string &filename);
+
+
+    //------------------------------------------------------------------------//
+    // Background Thread                                                      //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Starts a thread that processes the events - The callback is
+    ///   called from that thread.
+    void Start();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Stops the thread started by Start - Pending events are kept.
+    void Stop();
+
+
+    //------------------------------------------------------------------------//
+    // Event Loop Integration                                                 //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The inotify descriptor - Becomes readable when there are
+    ///   events to Process.
+    int GetFd() const { return m_fd; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the available events (without blocking) and delivers
+    ///   the ones whose debounce interval is over.
+    /// @returns
+    ///   How many callbacks were called.
+    int Process();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   How many milliseconds until the next pending event is due (or
+    ///   the next re-arm of a removed directory) - -1 if there's none
+    ///   (the poll(2) convention).
+    int GetTimeout() const;
+
+
+    //------------------------------------------------------------------------//
+    // Helpers                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Callback that invalidates the file in the cache - Together
+    ///   with FileCache::Validation::None the cache never stats.
+    /// @note
+    ///   The cache must outlive the watcher.
+    static Callback InvalidateCache(FileCache &cache);
+
+
+    //------------------------------------------------------------------------//
+    // Types                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct DirectoryWatch
+    {
+        std::string                        dirname;
+        std::map<std::string, std::string> files; // name -> filename.
+    };
+
+    struct PendingEvent
+    {
+        Event             event;
+        Clock::time_point deadline;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void ReadEvents  ();
+    void LoseWatch   (std::map<int, DirectoryWatch>::iterator it);
+    void RearmWatches();
+    void AddPending  (const std::string &filename, Event event);
+    void ThreadLoop  ();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Callback                  m_callback;
+    std::chrono::milliseconds m_debounce;
+
+    int m_fd;
+    int m_stopFd;
+
+    mutable std::mutex                  m_mutex;
+    std::map<int, DirectoryWatch>       m_watches;
+    std::vector<DirectoryWatch>         m_lostWatches; // Directory removed.
+    std::map<std::string, PendingEvent> m_pending;
+
+    std::thread m_thread;
+};
+
+NS_COREFILE_END
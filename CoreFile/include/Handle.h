@@ -0,0 +1,236 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Handle.h                                                      //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+// POSIX
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "OpenOptions.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Owner of a raw file descriptor.
+///   Lightweight alternative to the std::fstream returned by Open -
+///   No heap allocation, no locale, no stream buffer: each call is a
+///   single system call (or a loop of them for short transfers).
+///   Code that needs a std::iostream can wrap it in a HandleStream.
+/// @note
+///   The descriptor is closed when the object is destroyed.
+///   Handle is move-only.
+/// @see OpenOptions, HandleStream
+class Handle
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Creates a Handle that owns nothing.
+    Handle();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Takes the ownership of an already opened descriptor.
+    explicit Handle(int fd);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Opens the file.
+    /// @param filename
+    ///   The name of the file that will be opened.
+    /// @param options
+    ///   How the file will be opened.
+    /// @param permissions
+    ///   The permissions of the file if it's created (before umask).
+    /// @note
+    ///   OpenOptions::NoAtime is silently dropped when the process isn't
+    ///   allowed to use it (it's not the owner of the file).
+    /// @throws
+    ///   std::invalid_argument if the options aren't valid and
+    ///   std::ios::failure if the file couldn't be opened.
+    Handle(
+        const std::string &filename,
+        OpenOptions        options,
+        mode_t             permissions = 0666);
+
+    ~Handle();
+
+    Handle(Handle &&other);
+    Handle& operator =(Handle &&other);
+
+    Handle(const Handle &)            = delete;
+    Handle& operator =(const Handle &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads at the current position until size bytes were read or
+    ///   the end of the file was reached.
+    /// @returns
+    ///   The number of bytes read - Less than size only at end of file.
+    /// @throws std::runtime_error on read errors.
+    size_t Read(void *pData, size_t size);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes all the bytes at the current position.
+    /// @throws std::runtime_error on write errors.
+    void Write(const void *pData, size_t size);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads at the offset (pread(2)) - Doesn't move the current
+    ///   position, so many threads can share the Handle.
+    /// @returns
+    ///   The number of bytes read - Less than size only at end of file.
+    /// @throws std::runtime_error on read errors.
+    size_t ReadAt(void *pData, size_t size, uint64_t offset) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes all the bytes at the offset (pwrite(2)) - Doesn't move
+    ///   the current position.
+    /// @throws std::runtime_error on write errors.
+    void WriteAt(const void *pData, size_t size, uint64_t offset) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Scatter read at the current position with a single readv(2).
+    /// @returns
+    ///   The number of bytes read - May be less than the total size
+    ///   of the buffers.
+    /// @throws std::runtime_error on read errors.
+    size_t ReadV(const struct iovec *pIov, int count);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gather write at the current position (writev(2)) - All the
+    ///   buffers are written, short writes are resumed.
+    /// @throws std::runtime_error on write errors.
+    void WriteV(const struct iovec *pIov, int count);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as ReadV but at the offset (preadv(2)).
+    size_t ReadVAt(const struct iovec *pIov, int count, uint64_t offset) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as WriteV but at the offset (pwritev(2)).
+    void WriteVAt(const struct iovec *pIov, int count, uint64_t offset) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Moves the current position (lseek(2)).
+    /// @param offset
+    ///   The offset relative to whence.
+    /// @param whence
+    ///   SEEK_SET, SEEK_CUR or SEEK_END.
+    /// @returns The new position from the start of the file.
+    /// @throws std::runtime_error on errors.
+    uint64_t Seek(int64_t offset, int whence = SEEK_SET);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reserves disk space for the range (fallocate(2)), so later
+    ///   writes don't fail with ENOSPC nor fragment the file.
+    /// @param offset
+    ///   Start of the range.
+    /// @param length
+    ///   Length of the range.
+    /// @param keepSize
+    ///   If true the file size isn't changed, even if the range goes
+    ///   past the end of the file.
+    /// @note
+    ///   If the filesystem doesn't support fallocate(2) and keepSize is
+    ///   false, falls back to posix_fallocate(3).
+    /// @throws std::runtime_error on errors.
+    void Allocate(uint64_t offset, uint64_t length, bool keepSize = false);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the file size (ftruncate(2)).
+    /// @throws std::runtime_error on errors.
+    void Truncate(uint64_t size);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Flushes the data (and the metadata needed to read it back).
+    /// @throws std::runtime_error on errors.
+    void DataSync();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Flushes the data and all the metadata.
+    /// @throws std::runtime_error on errors.
+    void Sync();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Sets the access and modification times (futimens(2)), with
+    ///   nanoseconds.
+    /// @param pAccessTime / pModifyTime
+    ///   The new times - nullptr keeps the respective time.
+    /// @throws std::runtime_error on errors.
+    void SetTimes(
+        const struct timespec *pAccessTime,
+        const struct timespec *pModifyTime);
+
+    ///-------------------------------------------------------------------------
+    /// @brief The size of the file in bytes.
+    /// @throws std::runtime_error if the file couldn't be stat'ed.
+    size_t GetSize() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The owned descriptor - -1 if none.
+    int GetFd() const { return m_fd; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief If the Handle owns a descriptor.
+    bool IsValid() const { return m_fd != -1; }
+
+    explicit operator bool() const { return IsValid(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gives up the ownership of the descriptor without closing it.
+    /// @returns The descriptor - -1 if none.
+    int Release();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Closes the descriptor - Does nothing if there's none.
+    void Close();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    int m_fd;
+};
+
+NS_COREFILE_END
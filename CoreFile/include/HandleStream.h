@@ -0,0 +1,166 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : HandleStream.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <iostream>
+#include <streambuf>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "Handle.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   std::streambuf over a Handle - Reads and writes go straight to the
+///   descriptor through a single buffer of each kind.
+/// @note
+///   The buffers are only allocated on the first read / write.
+///   I/O errors don't throw, they're reported as eof / -1 so the owner
+///   stream sets its badbit (standard streambuf behavior).
+class HandleStreamBuf : public std::streambuf
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr size_t kDefaultBufferSize = 64 * 1024;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit HandleStreamBuf(
+        Handle handle,
+        size_t bufferSize = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the pending bytes - Errors are ignored.
+    ~HandleStreamBuf();
+
+    HandleStreamBuf(const HandleStreamBuf &)            = delete;
+    HandleStreamBuf& operator =(const HandleStreamBuf &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The underlying Handle.
+    /// @note
+    ///   Call pubsync() before using it directly, otherwise the buffered
+    ///   bytes and the descriptor position are out of sync.
+    Handle& GetHandle() { return m_handle; }
+
+
+    //------------------------------------------------------------------------//
+    // std::streambuf                                                         //
+    //------------------------------------------------------------------------//
+protected:
+    int_type underflow() override;
+    int_type overflow (int_type c = traits_type::eof()) override;
+    int      sync     () override;
+
+    pos_type seekoff(
+        off_type                off,
+        std::ios_base::seekdir  dir,
+        std::ios_base::openmode which = std::ios_base::in | std::ios_base::out)
+        override;
+
+    pos_type seekpos(
+        pos_type                pos,
+        std::ios_base::openmode which = std::ios_base::in | std::ios_base::out)
+        override;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    bool FlushWriteBuffer  ();
+    bool DiscardReadBuffer ();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Handle            m_handle;
+    size_t            m_bufferSize;
+    std::vector<char> m_readBuffer;
+    std::vector<char> m_writeBuffer;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   std::iostream that owns a Handle.
+///   Bridge for the code that still works with streams - i.e. the
+///   functions that take a std::istream& / std::ostream&.
+/// @see Handle
+class HandleStream : public std::iostream
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Takes the ownership of the handle.
+    /// @param handle
+    ///   The handle that will be read / written.
+    /// @param bufferSize
+    ///   The size of the read and of the write buffers.
+    explicit HandleStream(
+        Handle handle,
+        size_t bufferSize = HandleStreamBuf::kDefaultBufferSize);
+
+    HandleStream(const HandleStream &)            = delete;
+    HandleStream& operator =(const HandleStream &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The underlying Handle - @see HandleStreamBuf::GetHandle.
+    Handle& GetHandle() { return m_buffer.GetHandle(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief If the underlying Handle owns a descriptor.
+    bool IsOpen() { return m_buffer.GetHandle().IsValid(); }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    HandleStreamBuf m_buffer;
+};
+
+NS_COREFILE_END
@@ -0,0 +1,220 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Instrumentation.h                                             //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+// CoreFile
+#include "Config.h"
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   If the instrumentation was compiled in - When it's not, all the
+///   stats are always zero and recording them costs nothing.
+constexpr bool kInstrumentationEnabled = (COREFILE_INSTRUMENTATION != 0);
+
+///-----------------------------------------------------------------------------
+/// @brief The instrumented operations.
+enum class IoOperation
+{
+    Open,     ///< Open, OpenRead, OpenText, OpenWrite, Create, CreateText.
+    ReadAll,  ///< ReadAllBytes, ReadAllLines, ReadAllText.
+    WriteAll, ///< WriteAllBytes, WriteAllLines, WriteAllText.
+    Append,   ///< AppendAllLines, AppendAllText.
+    Copy,     ///< Copy (and each file of CopyMany).
+    Move,     ///< Move (and each file of MoveMany).
+    Delete    ///< Delete.
+};
+
+constexpr size_t kIoOperationCount = 7;
+
+
+//----------------------------------------------------------------------------//
+// LatencyHistogram                                                           //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   HDR style histogram of latencies in nanoseconds - Log linear
+///   buckets: each power of two is split in kSubBucketCount buckets,
+///   so any value is kept with ~12% of precision from 1ns to centuries.
+struct LatencyHistogram
+{
+    static constexpr size_t kSubBucketCount = 8;
+    static constexpr size_t kBucketCount    = 62 * kSubBucketCount;
+
+    uint64_t buckets[kBucketCount];
+    uint64_t count; ///< Number of recorded values.
+    uint64_t sum;   ///< Sum of the recorded values.
+
+    ///-------------------------------------------------------------------------
+    /// @brief The bucket of the value.
+    static size_t GetBucketIndex(uint64_t value);
+
+    ///-------------------------------------------------------------------------
+    /// @brief The smallest value of the bucket.
+    static uint64_t GetBucketLowerBound(size_t index);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The value below which the percentile (0 to 100) of the values
+    ///   are - Zero if nothing was recorded.
+    uint64_t GetPercentile(double percentile) const;
+};
+
+
+//----------------------------------------------------------------------------//
+// Stats                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief What was recorded for a single IoOperation.
+struct IoOperationStats
+{
+    uint64_t calls;    ///< Number of calls.
+    uint64_t errors;   ///< Calls that threw.
+    uint64_t bytes;    ///< Bytes read / written / copied.
+    uint64_t syscalls; ///< File related syscalls made by the calls.
+
+    LatencyHistogram latency; ///< Duration of the calls.
+};
+
+///-----------------------------------------------------------------------------
+/// @brief Snapshot of all the operations.
+struct IoStats
+{
+    IoOperationStats operations[kIoOperationCount];
+
+    const IoOperationStats& operator[](IoOperation operation) const
+    {
+        return operations[static_cast<size_t>(operation)];
+    }
+};
+
+///-----------------------------------------------------------------------------
+/// @brief The name of the operation, i.e. "read_all".
+const char* GetIoOperationName(IoOperation operation);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Sums the slots of all the threads (the ones that already finished
+///   included) - Never blocks the threads doing I/O.
+/// @note
+///   The counters of each thread are read while they may be updated,
+///   so the snapshot isn't atomic between different counters.
+IoStats GetIoStats();
+
+///-----------------------------------------------------------------------------
+/// @brief Zeros the stats of all the threads.
+void ResetIoStats();
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Formats the stats in the Prometheus text exposition format - The
+///   latencies are exported as histograms in seconds.
+std::string IoStatsToText(const IoStats &stats);
+
+
+//----------------------------------------------------------------------------//
+// IoStatsExporter                                                            //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Periodically writes IoStatsToText(GetIoStats()) to a file, so it
+///   can be picked up by a metrics scraper (i.e. the node_exporter
+///   textfile collector).
+/// @note
+///   The file is replaced atomically (WriteMode::Atomic), so the
+///   scraper never reads a partial one.
+class IoStatsExporter
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr std::chrono::milliseconds kDefaultInterval =
+        std::chrono::milliseconds(10 * 1000);
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Starts the thread that writes the file.
+    /// @param filename
+    ///   The file that will be written - Its directory must exist.
+    /// @param interval
+    ///   How often the file is written.
+    IoStatsExporter(
+        const std::string         &filename,
+        std::chrono::milliseconds  interval = kDefaultInterval);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Stops the thread, writing the file a last time.
+    ~IoStatsExporter();
+
+    IoStatsExporter(const IoStatsExporter &)            = delete;
+    IoStatsExporter& operator =(const IoStatsExporter &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the file now.
+    /// @throws std::runtime_error on write errors.
+    void Export();
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void ThreadLoop();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string               m_filename;
+    std::chrono::milliseconds m_interval;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_stopCondition;
+    bool                    m_stop;
+
+    std::thread m_thread;
+};
+
+NS_COREFILE_END
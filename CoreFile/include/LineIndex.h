@@ -0,0 +1,175 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineIndex.h                                                   //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+// Forward declarations.
+class Handle;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Offsets of the start of every line of a text file.
+///   Allows O(1) random access to the Nth line without rescanning the file.
+///   The index can be saved as a sidecar file and loaded back later,
+///   it's validated against the size and modification time of the file.
+///   The file is kept open by the index (and shared by its copies), so
+///   ReadLine is a single pread(2).
+/// @note
+///   Lines follow the same rules of LineReader - They're split at '\n',
+///   which isn't part of the line, and a trailing '\n' doesn't start
+///   a new empty line.
+/// @see BuildLineIndex, LineReader
+class LineIndex
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Creates an empty index - Use Build, Load or LoadOrBuild.
+    LineIndex();
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Scans the whole file for newlines and builds its index.
+    ///   The scan uses AVX2 / SSE2 when the CPU supports it.
+    /// @param filename
+    ///   The text file that will be indexed.
+    /// @throws std::ios::failure if the file couldn't be opened.
+    static LineIndex Build(const std::string &filename);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Loads the sidecar index of the file.
+    /// @param filename
+    ///   The text file that was indexed.
+    /// @param index
+    ///   Receives the loaded index.
+    /// @param indexFilename
+    ///   The sidecar file - Empty means GetSidecarFilename(filename).
+    /// @returns
+    ///   false if the sidecar doesn't exist, is corrupted or is stale,
+    ///   i.e. the file was modified after the index was built, or if
+    ///   its offsets don't fit the file.
+    static bool Load(
+        const std::string &filename,
+        LineIndex         &index,
+        const std::string &indexFilename = "");
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Loads the sidecar index if it's up to date, otherwise builds
+    ///   the index and saves it as the new sidecar.
+    static LineIndex LoadOrBuild(
+        const std::string &filename,
+        const std::string &indexFilename = "");
+
+    ///-------------------------------------------------------------------------
+    /// @brief The default sidecar filename - filename + ".lidx".
+    static std::string GetSidecarFilename(const std::string &filename);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Saves the index as a sidecar file.
+    /// @param indexFilename
+    ///   The sidecar file - Empty means GetSidecarFilename(GetFilename()).
+    /// @note
+    ///   The sidecar is replaced atomically (WriteMode::Atomic), so a
+    ///   crash never leaves a torn index. It uses the native byte order,
+    ///   it's not meant to be shared between machines.
+    void Save(const std::string &indexFilename = "") const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The number of lines of the file.
+    size_t GetLineCount() const { return m_offsets.size(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The offset in bytes where the line starts.
+    uint64_t GetLineOffset(size_t lineNumber) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The size in bytes of the line without the '\n'.
+    uint64_t GetLineLength(size_t lineNumber) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads a single line of the file with one positioned read.
+    /// @param lineNumber
+    ///   Zero based line number.
+    /// @throws
+    ///   std::out_of_range if lineNumber >= GetLineCount() and
+    ///   std::runtime_error if the file was truncated.
+    std::string ReadLine(size_t lineNumber) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief All the line start offsets.
+    const std::vector<uint64_t>& GetOffsets() const { return m_offsets; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The name of the indexed file.
+    const std::string& GetFilename() const { return m_filename; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string           m_filename;
+    uint64_t              m_fileSize;
+    int64_t               m_mtimeSec;
+    int64_t               m_mtimeNsec;
+    uint64_t              m_contentEnd; // File size without the trailing '\n'.
+    std::vector<uint64_t> m_offsets;
+
+    std::shared_ptr<Handle> m_pHandle; // Kept open for ReadLine.
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the offsets of every line start of the file.
+///   Same as LineIndex::Build(filename).GetOffsets().
+/// @param filename
+///   The text file that will be indexed.
+/// @see LineIndex
+std::vector<uint64_t> BuildLineIndex(const std::string &filename);
+
+NS_COREFILE_END
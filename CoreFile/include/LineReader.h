@@ -0,0 +1,181 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineReader.h                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "Handle.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Streaming line reader - Alternative to ReadAllLines that keeps the
+///   memory usage constant regardless of the size of the file.
+///   The file is read in large blocks and each line is yielded as a
+///   view into the internal buffer, so no allocation is made per line.
+/// @note
+///   The Line views are only valid until the next line is read.
+///   Call Line::ToString() to keep a copy.
+/// @note
+///   Lines are split at '\n' which is not included in the Line.
+///   A trailing '\n' at the end of file doesn't produce an empty line.
+///   A '\r' before the '\n' (CRLF) is kept in the Line, like ReadAllLines.
+/// @see ReadAllLines
+class LineReader
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Default size of the internal read buffer.
+    static const size_t kDefaultBufferSize = 1024 * 1024;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Non owning view of a line inside the reader buffer.
+    struct Line
+    {
+        const char *pData;
+        size_t      size;
+
+        std::string ToString() const { return std::string(pData, size); }
+
+        bool operator ==(const std::string &str) const
+        {
+            return str.size() == size && memcmp(str.data(), pData, size) == 0;
+        }
+        bool operator !=(const std::string &str) const
+        {
+            return !(*this == str);
+        }
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief Input iterator to allow range-for iteration.
+    class Iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef Line                    value_type;
+        typedef std::ptrdiff_t          difference_type;
+        typedef const Line*             pointer;
+        typedef const Line&             reference;
+
+    public:
+        explicit Iterator(LineReader *pReader = nullptr) :
+            m_pReader(pReader),
+            m_line   ({nullptr, 0})
+        {
+            ++(*this);
+        }
+
+        const Line& operator * () const { return  m_line; }
+        const Line* operator ->() const { return &m_line; }
+
+        Iterator& operator ++()
+        {
+            if(m_pReader && !m_pReader->Next(m_line))
+                m_pReader = nullptr;
+            return *this;
+        }
+
+        bool operator ==(const Iterator &rhs) const { return m_pReader == rhs.m_pReader; }
+        bool operator !=(const Iterator &rhs) const { return m_pReader != rhs.m_pReader; }
+
+    private:
+        LineReader *m_pReader;
+        Line        m_line;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Opens the file for line reading.
+    /// @param filename
+    ///   The name of the file that will be read.
+    /// @param bufferSize
+    ///   Initial size of the read buffer - It grows only if a single
+    ///   line doesn't fit into it.
+    /// @throws std::ios::failure if the file couldn't be opened.
+    explicit LineReader(
+        const std::string &filename,
+        size_t             bufferSize = kDefaultBufferSize);
+
+    LineReader(const LineReader &)            = delete;
+    LineReader& operator =(const LineReader &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the next line.
+    /// @param line
+    ///   Receives the view of the line.
+    /// @returns
+    ///   false when there are no more lines.
+    /// @throws std::runtime_error on read errors.
+    bool Next(Line &line);
+
+    ///-------------------------------------------------------------------------
+    /// @brief The number of lines read so far.
+    size_t GetLineNumber() const { return m_lineNumber; }
+
+    Iterator begin() { return Iterator(this); }
+    Iterator end  () { return Iterator();     }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void Refill();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string       m_filename;
+    Handle            m_handle;
+    std::vector<char> m_buffer;
+    size_t            m_begin;    // Start of the unread data.
+    size_t            m_scanned;  // Data before this offset has no '\n'.
+    size_t            m_end;      // End of the valid data.
+    bool              m_eof;
+    size_t            m_lineNumber;
+};
+
+NS_COREFILE_END
@@ -0,0 +1,146 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : MappedFile.h                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Read-only memory mapped view of a whole file.
+///   Alternative to ReadAllBytes that doesn't copy the file contents
+///   into the heap - The pages are shared with the page cache and with
+///   any other process that maps the same file.
+/// @note
+///   The mapping is released when the object is destroyed.
+///   MappedFile is move-only.
+/// @see ReadAllBytes
+class MappedFile
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Hints about how the mapped memory is going to be accessed.
+    /// @see madvise(2)
+    enum class Advice
+    {
+        Normal,     ///< No special treatment.
+        Sequential, ///< Pages will be accessed in sequential order.
+        Random,     ///< Pages will be accessed in random order.
+        WillNeed,   ///< Pages will be needed soon - Start read ahead.
+        DontNeed    ///< Pages won't be needed soon.
+    };
+
+    typedef const byte_t* const_iterator;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Maps the whole file in read-only mode.
+    /// @param filename
+    ///   The name of the file that will be mapped.
+    /// @param advice
+    ///   The initial access pattern hint for the whole mapping.
+    /// @throws
+    ///   std::ios::failure if the file couldn't be opened and
+    ///   std::runtime_error if it couldn't be mapped.
+    explicit MappedFile(
+        const std::string &filename,
+        Advice             advice = Advice::Normal);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile &&other);
+    MappedFile& operator =(MappedFile &&other);
+
+    MappedFile(const MappedFile &)            = delete;
+    MappedFile& operator =(const MappedFile &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gives an access pattern hint to the kernel for a range of the file.
+    /// @param advice
+    ///   The access pattern hint.
+    /// @param offset
+    ///   Start of the range - Rounded down to the page boundary.
+    /// @param length
+    ///   Length of the range - 0 means until the end of the file.
+    /// @note
+    ///   Hints are advisory, failures are silently ignored.
+    void Advise(Advice advice, size_t offset = 0, size_t length = 0) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Pointer to the first byte of the file - nullptr if empty.
+    const byte_t* Data() const { return m_pData; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The size of the mapped file in bytes.
+    size_t Size() const { return m_size; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief If the mapped file has no bytes.
+    bool IsEmpty() const { return m_size == 0; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The name of the mapped file.
+    const std::string& GetFilename() const { return m_filename; }
+
+    const byte_t& operator [](size_t index) const { return m_pData[index]; }
+
+    const_iterator begin() const { return m_pData;          }
+    const_iterator end  () const { return m_pData + m_size; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void Unmap();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string  m_filename;
+    byte_t      *m_pData;
+    size_t       m_size;
+};
+
+NS_COREFILE_END
@@ -0,0 +1,140 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : MemoryBackend.h                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+
+// std
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+// CoreFile
+#include "Backend.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Backend that keeps the files in memory - Meant to test code that
+///   uses the whole file functions without touching the disk, or as a
+///   scratch area (@see OverlayBackend).
+/// @note
+///   It's thread safe - The files are split in stripes by the hash of
+///   their names, each one with its own lock, so threads working on
+///   different files rarely wait on each other.
+///
+///   There are no directories, any name is a valid file. The WriteMode
+///   and Durability are ignored - Every write is atomic.
+class MemoryBackend :
+    public Backend
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr size_t kDefaultStripeCount = 16;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit MemoryBackend(size_t stripeCount = kDefaultStripeCount);
+
+    MemoryBackend(const MemoryBackend &)            = delete;
+    MemoryBackend& operator =(const MemoryBackend &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Backend                                                                //
+    //------------------------------------------------------------------------//
+public:
+    bool ReadFile(const std::string &filename, std::string         &contents) override;
+    bool ReadFile(const std::string &filename, std::vector<byte_t> &contents) override;
+
+    void WriteFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size,
+        WriteMode          mode,
+        Durability         durability) override;
+
+    void AppendFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size) override;
+
+    bool   DeleteFile (const std::string &filename) override;
+    bool   IsFile     (const std::string &filename) override;
+    size_t GetFileSize(const std::string &filename) override;
+
+    void CopyFile(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite) override;
+
+    void MoveFile(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite) override;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The names of all the files, sorted.
+    std::vector<std::string> GetFilenames();
+
+    ///-------------------------------------------------------------------------
+    /// @brief Removes all the files.
+    void Clear();
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    struct Stripe
+    {
+        std::mutex                                   mutex;
+        std::unordered_map<std::string, std::string> files;
+    };
+
+    Stripe& GetStripe(const std::string &filename);
+
+    void Transfer(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite,
+        bool               removeSource);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<Stripe> m_stripes;
+};
+
+NS_COREFILE_END
@@ -0,0 +1,115 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Metadata.h                                                    //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Everything that a single statx(2) tells about a file.
+struct FileMetadata
+{
+    /// 0 if the metadata is valid, the errno of the failure otherwise.
+    /// Only set by the batch GetMetadata - The single one throws.
+    int error;
+
+    /// Size of the file in bytes.
+    uint64_t size;
+    /// File type and permissions (st_mode).
+    uint32_t mode;
+    /// Number of hard links.
+    uint32_t links;
+    /// Inode and device - Together they identify the file.
+    uint64_t inode;
+    uint64_t device;
+    /// Owner.
+    uint32_t uid;
+    uint32_t gid;
+
+    /// Last access, last modification (the one of GetLastWriteTime),
+    /// last status change and creation times, with nanoseconds.
+    struct timespec accessTime;
+    struct timespec modifyTime;
+    struct timespec changeTime;
+    struct timespec birthTime;
+
+    /// If the filesystem reported the creation time - It's zero otherwise.
+    bool hasBirthTime;
+
+    bool IsValid    () const { return error == 0; }
+    bool IsFile     () const;
+    bool IsDirectory() const;
+    bool IsSymlink  () const;
+};
+
+
+//----------------------------------------------------------------------------//
+// Metadata                                                                   //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Gets all the metadata of the file with a single statx(2) -
+///   Alternative to calling GetSize and the Get*Time functions one by
+///   one.
+/// @param filename
+///   The name of the file.
+/// @param followSymlinks
+///   If false the metadata is of the symlink itself (like lstat(2)).
+/// @returns
+///   The metadata of the file.
+/// @throws
+///   std::runtime_error if the file couldn't be stat'ed.
+FileMetadata GetMetadata(
+    const std::string &filename,
+    bool               followSymlinks = true);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Gets the metadata of many files at once - The stats are spread
+///   over a pool of threads, so the latency of each one overlaps with
+///   the others (useful for network filesystems and cold caches).
+/// @param filenames
+///   The names of the files.
+/// @param threads
+///   The number of threads - 0 means std::thread::hardware_concurrency.
+///   Small batches are stat'ed on the calling thread.
+/// @param followSymlinks
+///   If false the metadata is of the symlinks themselves.
+/// @returns
+///   The metadata of each file, in the same order of filenames.
+///   Failures don't throw, they are reported in FileMetadata::error.
+std::vector<FileMetadata> GetMetadata(
+    const std::vector<std::string> &filenames,
+    size_t                          threads        = 0,
+    bool                            followSymlinks = true);
+
+NS_COREFILE_END
@@ -0,0 +1,193 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OpenOptions.h                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+// POSIX
+#include <fcntl.h>
+// CoreFile
+#include "CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Typed flags describing how a file is opened.
+///   Typed alternative to the FileMode strings - Combined with the
+///   operator | and translated to open(2) flags without any parsing.
+/// @note
+///   Every function here is constexpr, so the options (and their
+///   validation) can be resolved at compile time:
+///   @code
+///     constexpr auto kOptions = OpenOptions::Write | OpenOptions::Create;
+///     static_assert(IsValidOpenOptions(kOptions), "Invalid options");
+///   @endcode
+/// @see Handle
+enum class OpenOptions : uint32_t
+{
+    None        = 0,
+    Read        = 1 << 0, ///< Open for reading.
+    Write       = 1 << 1, ///< Open for writing.
+    Append      = 1 << 2, ///< Every write goes to the end (O_APPEND).
+    Create      = 1 << 3, ///< Create the file if it doesn't exist (O_CREAT).
+    Exclusive   = 1 << 4, ///< Fail if the file exists (O_EXCL).
+    Truncate    = 1 << 5, ///< Truncate the file to 0 bytes (O_TRUNC).
+    Direct      = 1 << 6, ///< Bypass the page cache (O_DIRECT).
+    Sync        = 1 << 7, ///< Writes wait for data and metadata (O_SYNC).
+    DataSync    = 1 << 8, ///< Writes wait for data only (O_DSYNC).
+    NoAtime     = 1 << 9, ///< Don't update the access time (O_NOATIME).
+    CloseOnExec = 1 << 10 ///< Don't leak to child processes (O_CLOEXEC).
+};
+
+constexpr OpenOptions operator |(OpenOptions lhs, OpenOptions rhs)
+{
+    return static_cast<OpenOptions>(
+        static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)
+    );
+}
+
+constexpr OpenOptions operator &(OpenOptions lhs, OpenOptions rhs)
+{
+    return static_cast<OpenOptions>(
+        static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)
+    );
+}
+
+constexpr OpenOptions operator ~(OpenOptions options)
+{
+    return static_cast<OpenOptions>(~static_cast<uint32_t>(options));
+}
+
+inline OpenOptions& operator |=(OpenOptions &lhs, OpenOptions rhs)
+{
+    return lhs = lhs | rhs;
+}
+
+inline OpenOptions& operator &=(OpenOptions &lhs, OpenOptions rhs)
+{
+    return lhs = lhs & rhs;
+}
+
+
+//----------------------------------------------------------------------------//
+// Functions                                                                  //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Checks if all the bits of flag are set in options.
+constexpr bool HasOption(OpenOptions options, OpenOptions flag)
+{
+    return (options & flag) == flag && flag != OpenOptions::None;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Checks if the combination of options makes sense, i.e:
+///     - At least one of Read / Write is set.
+///     - Append, Create, Exclusive and Truncate are only set with Write.
+///     - Exclusive is only set with Create.
+/// @returns
+///   true if the options are valid, false otherwise.
+constexpr bool IsValidOpenOptions(OpenOptions options)
+{
+    return
+        (HasOption(options, OpenOptions::Read) ||
+         HasOption(options, OpenOptions::Write))
+        &&
+        (HasOption(options, OpenOptions::Write) ||
+         (options & (OpenOptions::Append    |
+                     OpenOptions::Create    |
+                     OpenOptions::Exclusive |
+                     OpenOptions::Truncate)) == OpenOptions::None)
+        &&
+        (!HasOption(options, OpenOptions::Exclusive) ||
+          HasOption(options, OpenOptions::Create));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Translates the options to the open(2) flags.
+/// @note
+///   Options not supported by the platform are mapped to 0.
+///   The result is meaningless if the options aren't valid.
+/// @see IsValidOpenOptions
+constexpr int ToPosixFlags(OpenOptions options)
+{
+    return
+        // Access mode.
+        (HasOption(options, OpenOptions::Read | OpenOptions::Write)
+            ? O_RDWR
+            : HasOption(options, OpenOptions::Write) ? O_WRONLY : O_RDONLY)
+        // Creation / Status flags.
+        | (HasOption(options, OpenOptions::Append     ) ? O_APPEND : 0)
+        | (HasOption(options, OpenOptions::Create     ) ? O_CREAT  : 0)
+        | (HasOption(options, OpenOptions::Exclusive  ) ? O_EXCL   : 0)
+        | (HasOption(options, OpenOptions::Truncate   ) ? O_TRUNC  : 0)
+        | (HasOption(options, OpenOptions::Sync       ) ? O_SYNC   : 0)
+        | (HasOption(options, OpenOptions::DataSync   ) ? O_DSYNC  : 0)
+        | (HasOption(options, OpenOptions::CloseOnExec) ? O_CLOEXEC: 0)
+#if defined(O_DIRECT)
+        | (HasOption(options, OpenOptions::Direct     ) ? O_DIRECT : 0)
+#endif
+#if defined(O_NOATIME)
+        | (HasOption(options, OpenOptions::NoAtime    ) ? O_NOATIME: 0)
+#endif
+        ;
+}
+
+
+//----------------------------------------------------------------------------//
+// Common Combinations                                                        //
+//----------------------------------------------------------------------------//
+namespace OpenMode {
+    ///-------------------------------------------------------------------------
+    /// @brief Same as FileMode::Binary::kRead.
+    constexpr auto kRead =
+        OpenOptions::Read | OpenOptions::CloseOnExec;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as FileMode::Binary::kWrite.
+    constexpr auto kWrite =
+        OpenOptions::Write    | OpenOptions::Create |
+        OpenOptions::Truncate | OpenOptions::CloseOnExec;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as FileMode::Binary::kReadWrite_Open.
+    constexpr auto kReadWrite =
+        OpenOptions::Read | OpenOptions::Write | OpenOptions::CloseOnExec;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as FileMode::Binary::kAppend (without reading).
+    constexpr auto kAppend =
+        OpenOptions::Write  | OpenOptions::Create |
+        OpenOptions::Append | OpenOptions::CloseOnExec;
+
+    static_assert(IsValidOpenOptions(kRead     ), "Invalid OpenMode::kRead"     );
+    static_assert(IsValidOpenOptions(kWrite    ), "Invalid OpenMode::kWrite"    );
+    static_assert(IsValidOpenOptions(kReadWrite), "Invalid OpenMode::kReadWrite");
+    static_assert(IsValidOpenOptions(kAppend   ), "Invalid OpenMode::kAppend"   );
+}
+
+NS_COREFILE_END
@@ -0,0 +1,126 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OverlayBackend.h                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+
+// std
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+// CoreFile
+#include "Backend.h"
+
+
+NS_COREFILE_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Backend that stacks two others, like overlayfs - The files are
+///   read from the upper one and, when not there, from the lower one.
+///   All the changes go to the upper one, the lower is never modified.
+/// @note
+///   Deleting a file that exists in the lower backend leaves a whiteout,
+///   that hides it until it's written again.
+///
+///   Appending to a file that is only in the lower backend copies it
+///   up first.
+///
+///   Each call is thread safe as long as the stacked backends are, but
+///   calls touching both layers aren't atomic between each other.
+/// @par Example:
+///   MemoryBackend scratch;
+///   OverlayBackend overlay(scratch, GetPosixBackend());
+///   ScopedBackend  scope(overlay);
+///   // Reads the disk, writes to the memory.
+class OverlayBackend :
+    public Backend
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param upper The backend that receives the changes.
+    /// @param lower The read only backend - Must outlive the overlay.
+    OverlayBackend(Backend &upper, Backend &lower);
+
+    OverlayBackend(const OverlayBackend &)            = delete;
+    OverlayBackend& operator =(const OverlayBackend &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Backend                                                                //
+    //------------------------------------------------------------------------//
+public:
+    bool ReadFile(const std::string &filename, std::string         &contents) override;
+    bool ReadFile(const std::string &filename, std::vector<byte_t> &contents) override;
+
+    void WriteFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size,
+        WriteMode          mode,
+        Durability         durability) override;
+
+    void AppendFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size) override;
+
+    bool   DeleteFile (const std::string &filename) override;
+    bool   IsFile     (const std::string &filename) override;
+    size_t GetFileSize(const std::string &filename) override;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The files of the lower backend that were deleted, sorted.
+    std::vector<std::string> GetWhiteouts();
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    bool IsWhiteout    (const std::string &filename);
+    void AddWhiteout   (const std::string &filename);
+    void RemoveWhiteout(const std::string &filename);
+
+    template <typename Container>
+    bool ReadFileT(const std::string &filename, Container &contents);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Backend &m_upper;
+    Backend &m_lower;
+
+    std::mutex            m_whiteoutsMutex;
+    std::set<std::string> m_whiteouts;
+};
+
+NS_COREFILE_END
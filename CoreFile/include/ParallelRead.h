@@ -0,0 +1,113 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParallelRead.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+// CoreFile
+#include "CoreFile_Utils.h"
+#include "CoreFile.h"
+
+
+NS_COREFILE_BEGIN
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Default size of each chunk read by a thread.
+constexpr size_t kParallelReadDefaultChunkSize = 8 * 1024 * 1024;
+
+///-----------------------------------------------------------------------------
+/// @brief How the file is split into chunks.
+enum class ChunkSplit
+{
+    Bytes, ///< Chunks have exactly chunkSize bytes (except the last one).
+    Lines  ///< Chunks are extended until the end of the line, so no line
+           ///< is split between two chunks.
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Callback that receives each chunk of the file.
+///   Arguments are: offset of the chunk in the file, pointer to the
+///   chunk data and size of the chunk.
+/// @note
+///   The data is only valid during the call.
+typedef std::function<void (uint64_t, const byte_t *, size_t)> ChunkCallback;
+
+
+//----------------------------------------------------------------------------//
+// Parallel Read                                                              //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Reads the whole file using many threads - Each thread reads disjoint
+///   ranges with pread(2) straight into one preallocated buffer.
+///   Same result of ReadAllBytes, but can saturate fast devices (NVMe).
+/// @param filename
+///   The name of the file that will be read.
+/// @param chunkSize
+///   The size of each range read by a single call.
+/// @param threads
+///   The number of threads - 0 means std::thread::hardware_concurrency.
+/// @returns
+///   A vector of bytes.
+/// @throws
+///   std::ios::failure if the file couldn't be opened and
+///   std::runtime_error on read errors.
+/// @see ReadAllBytes
+std::vector<byte_t> ParallelRead(
+    const std::string &filename,
+    size_t             chunkSize = kParallelReadDefaultChunkSize,
+    size_t             threads   = 0);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Reads the file using many threads and hands each chunk to the
+///   callback while it's still hot in cache - The whole file is never
+///   held in memory.
+/// @param filename
+///   The name of the file that will be read.
+/// @param callback
+///   Function called for each chunk.
+///   It's called concurrently by the worker threads and the chunks
+///   arrive in no particular order.
+/// @param chunkSize
+///   The (minimum, when splitting at lines) size of each chunk.
+/// @param threads
+///   The number of threads - 0 means std::thread::hardware_concurrency.
+/// @param split
+///   How the file will be split into chunks.
+/// @note
+///   If the callback throws, the remaining chunks are skipped and the
+///   first exception is rethrown on the calling thread.
+void ParallelReadChunks(
+    const std::string   &filename,
+    const ChunkCallback &callback,
+    size_t               chunkSize = kParallelReadDefaultChunkSize,
+    size_t               threads   = 0,
+    ChunkSplit           split     = ChunkSplit::Bytes);
+
+NS_COREFILE_END
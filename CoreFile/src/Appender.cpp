@@ -0,0 +1,402 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Appender.cpp                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Appender.h"
+// std
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+// POSIX
+#include <sys/uio.h>
+// CoreFile
+#include "private/Mpsc_Queue.h"
+#include "private/Posix_Helpers.h"
+// CoreFS
+#include "CoreFS/CoreFS.h"
+
+// Usings
+using namespace CoreFile;
+typedef std::chrono::steady_clock Clock;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+// A queued record - Or a flush barrier when pBarrier is set.
+struct RecordNode :
+    public Private::MpscNode
+{
+    std::string          data;
+    std::promise<void>  *pBarrier;
+
+    RecordNode() : pBarrier(nullptr) {}
+};
+
+
+//----------------------------------------------------------------------------//
+// AppenderImpl                                                               //
+//----------------------------------------------------------------------------//
+class CoreFile::Private::AppenderImpl
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    AppenderImpl(const std::string &filename, const Appender::Options &options) :
+        m_filename       (filename),
+        m_options        (options),
+        m_fd             (open_fd(filename, O_WRONLY | O_CREAT | O_APPEND)),
+        m_pendingBytes   (0),
+        m_sleeping       (false),
+        m_urgent         (false),
+        m_stopping       (false),
+        m_failed         (false),
+        m_bytesWritten   (0),
+        m_batchesCommitted(0)
+    {
+        if(m_options.durability == Durability::Full)
+            fsync_parent_directory(filename);
+
+        m_writer = std::thread(&AppenderImpl::WriterLoop, this);
+    }
+
+    // COWNOTE(n2omatt): An error of the last batches can't be thrown
+    //   from here - It's dropped, callers that care must Flush first.
+    ~AppenderImpl()
+    {
+        m_stopping = true;
+        WakeUpWriter(true);
+        m_writer.join();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Producer Side                                                          //
+    //------------------------------------------------------------------------//
+public:
+    void Push(RecordNode *pNode)
+    {
+        std::unique_ptr<RecordNode> p_guard(pNode);
+        ThrowIfFailed();
+
+        m_queue.Push(p_guard.release());
+        WakeUpWriter(false);
+    }
+
+    void Flush()
+    {
+        std::promise<void> barrier;
+        auto future = barrier.get_future();
+
+        auto p_node = new RecordNode();
+        p_node->pBarrier = &barrier;
+
+        m_queue.Push(p_node);
+        WakeUpWriter(true);
+
+        future.get();
+    }
+
+    const std::string& GetFilename() const { return m_filename; }
+
+    uint64_t GetBytesWritten    () const { return m_bytesWritten;     }
+    uint64_t GetBatchesCommitted() const { return m_batchesCommitted; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void ThrowIfFailed()
+    {
+        // Keeps the fast path lock free.
+        if(!m_failed.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_pException)
+            std::rethrow_exception(m_pException);
+    }
+
+    //--------------------------------------------------------------------------
+    // COWNOTE(n2omatt): Producers only touch the mutex when the writer is
+    //   (about to go) sleeping. The seq_cst fence pairs with the one in
+    //   WriterLoop, so either the producer sees m_sleeping or the writer
+    //   sees the pushed node - A wake up is never lost.
+    void WakeUpWriter(bool urgent)
+    {
+        if(urgent)
+            m_urgent = true;
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(!m_sleeping.load(std::memory_order_relaxed) && !urgent)
+            return;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond.notify_one();
+    }
+
+    //--------------------------------------------------------------------------
+    void WriterLoop()
+    {
+        while(true)
+        {
+            Drain();
+
+            auto has_pending = !m_batch.empty();
+            auto stopping    = m_stopping.load();
+            auto urgent      = m_urgent.exchange(false);
+
+            if(has_pending && (stopping || urgent || ShouldCommit()))
+            {
+                Commit();
+                continue;
+            }
+
+            if(stopping && m_queue.IsEmpty())
+                return;
+
+            //------------------------------------------------------------------
+            // Sleep until a producer arrives or the batch latency expires.
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_sleeping = true;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if(m_queue.IsEmpty() && !m_urgent && !m_stopping)
+            {
+                if(has_pending)
+                    m_cond.wait_until(lock, m_batchStart + m_options.maxLatency);
+                else
+                    m_cond.wait(lock);
+            }
+
+            m_sleeping = false;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void Drain()
+    {
+        while(auto p_node = static_cast<RecordNode *>(m_queue.Pop()))
+        {
+            if(p_node->pBarrier)
+            {
+                // Everything queued before the barrier is committed now.
+                if(!m_batch.empty())
+                    Commit();
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(m_pException)
+                    p_node->pBarrier->set_exception(m_pException);
+                else
+                    p_node->pBarrier->set_value();
+
+                delete p_node;
+                continue;
+            }
+
+            if(m_batch.empty())
+                m_batchStart = Clock::now();
+
+            m_pendingBytes += p_node->data.size();
+            m_batch.push_back(p_node);
+
+            if(m_pendingBytes >= m_options.maxBatchBytes)
+                Commit();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    bool ShouldCommit() const
+    {
+        if(m_pendingBytes >= m_options.maxBatchBytes)
+            return true;
+
+        return Clock::now() >= m_batchStart + m_options.maxLatency;
+    }
+
+    //--------------------------------------------------------------------------
+    // Writes the whole batch with writev(2) and syncs it once.
+    void Commit()
+    {
+        try {
+            WriteBatch();
+            SyncBatch();
+        } catch(...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(!m_pException)
+                m_pException = std::current_exception();
+            m_failed = true;
+        }
+
+        for(auto p_node : m_batch)
+            delete p_node;
+
+        m_batch.clear();
+        m_pendingBytes = 0;
+        ++m_batchesCommitted;
+    }
+
+    //--------------------------------------------------------------------------
+    void WriteBatch()
+    {
+        std::vector<struct iovec> iovs;
+        iovs.reserve(m_batch.size());
+
+        size_t total = 0;
+        for(auto p_node : m_batch)
+        {
+            auto &data = p_node->data;
+            if(data.empty())
+                continue;
+
+            iovs.push_back({ &data[0], data.size() });
+            total += data.size();
+        }
+
+        writev_all(
+            m_fd.Get(),
+            iovs.data(),
+            static_cast<int>(iovs.size()),
+            nullptr,
+            m_filename
+        );
+        m_bytesWritten += total;
+    }
+
+    //--------------------------------------------------------------------------
+    void SyncBatch()
+    {
+        sync_file(m_fd.Get(), m_options.durability, m_filename);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string        m_filename;
+    Appender::Options  m_options;
+    ScopedFd           m_fd;
+
+    // Queue.
+    MpscQueue                 m_queue;
+    std::vector<RecordNode *> m_batch;
+    size_t                    m_pendingBytes;
+    Clock::time_point         m_batchStart;
+
+    // Writer thread.
+    std::thread             m_writer;
+    std::mutex              m_mutex;
+    std::condition_variable m_cond;
+    std::atomic<bool>       m_sleeping;
+    std::atomic<bool>       m_urgent;
+    std::atomic<bool>       m_stopping;
+    std::atomic<bool>       m_failed;
+    std::exception_ptr      m_pException;
+
+    // Stats.
+    std::atomic<uint64_t> m_bytesWritten;
+    std::atomic<uint64_t> m_batchesCommitted;
+};
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Appender::Appender(
+    const std::string &filename,
+    const Options     &options /* = Options() */) :
+    // Members.
+    m_pImpl(new Private::AppenderImpl(filename, options))
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+Appender::~Appender()
+{
+    // Empty - The impl commits the pending records on destruction.
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void Appender::Append(const std::string &record)
+{
+    auto p_node = new RecordNode();
+    p_node->data = record;
+
+    m_pImpl->Push(p_node);
+}
+
+//------------------------------------------------------------------------------
+void Appender::Append(const void *pData, size_t size)
+{
+    auto p_node = new RecordNode();
+    p_node->data.assign(static_cast<const char *>(pData), size);
+
+    m_pImpl->Push(p_node);
+}
+
+//------------------------------------------------------------------------------
+void Appender::AppendLine(const std::string &line)
+{
+    auto new_line = CoreFS::NewLine();
+
+    auto p_node = new RecordNode();
+    p_node->data.reserve(line.size() + new_line.size());
+    p_node->data.append(line);
+    p_node->data.append(new_line);
+
+    m_pImpl->Push(p_node);
+}
+
+//------------------------------------------------------------------------------
+void Appender::Flush()
+{
+    m_pImpl->Flush();
+}
+
+//------------------------------------------------------------------------------
+const std::string& Appender::GetFilename() const
+{
+    return m_pImpl->GetFilename();
+}
+
+//------------------------------------------------------------------------------
+uint64_t Appender::GetBytesWritten() const
+{
+    return m_pImpl->GetBytesWritten();
+}
+
+//------------------------------------------------------------------------------
+uint64_t Appender::GetBatchesCommitted() const
+{
+    return m_pImpl->GetBatchesCommitted();
+}
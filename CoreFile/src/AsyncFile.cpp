@@ -0,0 +1,257 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : AsyncFile.cpp                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/AsyncFile.h"
+// CoreFile
+#include "private/Async_Engine.h"
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Creates an operation that fulfills the promise when completed.
+static AsyncOperation make_future_operation(
+    AsyncOperation::Type                  type,
+    int                                   fd,
+    void                                 *pBuffer,
+    size_t                                size,
+    uint64_t                              offset,
+    std::shared_ptr<std::promise<size_t>> pPromise)
+{
+    AsyncOperation op;
+    op.type     = type;
+    op.fd       = fd;
+    op.pBuffer  = pBuffer;
+    op.size     = size;
+    op.offset   = offset;
+    op.callback = [pPromise, type](int error, size_t bytes) {
+        if(error == 0)
+        {
+            pPromise->set_value(bytes);
+            return;
+        }
+
+        auto msg = std::string("Failed async ")
+                 + ((type == AsyncOperation::Type::Read) ? "read" : "write")
+                 + " - error: (" + strerror(error) + ")";
+        pPromise->set_exception(std::make_exception_ptr(std::runtime_error(msg)));
+    };
+
+    return op;
+}
+
+
+//----------------------------------------------------------------------------//
+// AsyncIO                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+AsyncIO::AsyncIO(
+    AsyncBackend backend    /* = AsyncBackend::Auto */,
+    size_t       queueDepth /* = 256 */,
+    size_t       threads    /* = 0 */)
+{
+    if(backend != AsyncBackend::ThreadPool)
+        m_pEngine = Private::create_io_uring_engine(queueDepth);
+
+    COREASSERT_THROW_IF_NOT(
+        m_pEngine || backend != AsyncBackend::IoUring,
+        std::runtime_error,
+        "io_uring isn't available on this system"
+    );
+
+    if(!m_pEngine)
+        m_pEngine = Private::create_thread_pool_engine(threads);
+}
+
+//------------------------------------------------------------------------------
+AsyncIO::~AsyncIO()
+{
+    // Empty - The engines wait for pending operations on destruction.
+}
+
+//------------------------------------------------------------------------------
+AsyncIO& AsyncIO::GetDefault()
+{
+    static AsyncIO s_io;
+    return s_io;
+}
+
+//------------------------------------------------------------------------------
+void AsyncIO::Submit(const AsyncOperation &operation)
+{
+    m_pEngine->Submit(&operation, 1);
+}
+
+//------------------------------------------------------------------------------
+void AsyncIO::Submit(const std::vector<AsyncOperation> &operations)
+{
+    if(!operations.empty())
+        m_pEngine->Submit(operations.data(), operations.size());
+}
+
+//------------------------------------------------------------------------------
+std::future<size_t> AsyncIO::Read(
+    int       fd,
+    void     *pBuffer,
+    size_t    size,
+    uint64_t  offset)
+{
+    auto p_promise = std::make_shared<std::promise<size_t>>();
+    auto future    = p_promise->get_future();
+
+    Submit(make_future_operation(
+        AsyncOperation::Type::Read, fd, pBuffer, size, offset, p_promise
+    ));
+
+    return future;
+}
+
+//------------------------------------------------------------------------------
+std::future<size_t> AsyncIO::Write(
+    int         fd,
+    const void *pBuffer,
+    size_t      size,
+    uint64_t    offset)
+{
+    auto p_promise = std::make_shared<std::promise<size_t>>();
+    auto future    = p_promise->get_future();
+
+    Submit(make_future_operation(
+        AsyncOperation::Type::Write,
+        fd,
+        const_cast<void *>(pBuffer),
+        size,
+        offset,
+        p_promise
+    ));
+
+    return future;
+}
+
+//------------------------------------------------------------------------------
+AsyncBackend AsyncIO::GetBackend() const
+{
+    return m_pEngine->GetBackend();
+}
+
+
+//----------------------------------------------------------------------------//
+// AsyncFile                                                                  //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+AsyncFile::AsyncFile(
+    const std::string &filename,
+    const std::string &filemode,
+    AsyncIO           &io /* = AsyncIO::GetDefault() */) :
+    // Members.
+    m_filename(filename),
+    m_fd      (-1),
+    m_pIO     (&io)
+{
+    auto flags = Private::filemode_to_open_flags(filemode);
+    m_fd = Private::open_fd(filename, flags).Release();
+}
+
+//------------------------------------------------------------------------------
+AsyncFile::~AsyncFile()
+{
+    if(m_fd != -1)
+        close(m_fd);
+}
+
+//------------------------------------------------------------------------------
+AsyncFile::AsyncFile(AsyncFile &&other) :
+    // Members.
+    m_filename(std::move(other.m_filename)),
+    m_fd      (other.m_fd),
+    m_pIO     (other.m_pIO)
+{
+    other.m_fd = -1;
+}
+
+//------------------------------------------------------------------------------
+AsyncFile& AsyncFile::operator =(AsyncFile &&other)
+{
+    if(this == &other)
+        return *this;
+
+    if(m_fd != -1)
+        close(m_fd);
+
+    m_filename = std::move(other.m_filename);
+    m_fd       = other.m_fd;
+    m_pIO      = other.m_pIO;
+
+    other.m_fd = -1;
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+std::future<size_t> AsyncFile::ReadAt(void *pBuffer, size_t size, uint64_t offset)
+{
+    return m_pIO->Read(m_fd, pBuffer, size, offset);
+}
+
+//------------------------------------------------------------------------------
+void AsyncFile::ReadAt(
+    void                *pBuffer,
+    size_t               size,
+    uint64_t             offset,
+    const AsyncCallback &callback)
+{
+    m_pIO->Submit({
+        AsyncOperation::Type::Read, m_fd, pBuffer, size, offset, callback
+    });
+}
+
+//------------------------------------------------------------------------------
+std::future<size_t> AsyncFile::WriteAt(const void *pBuffer, size_t size, uint64_t offset)
+{
+    return m_pIO->Write(m_fd, pBuffer, size, offset);
+}
+
+//------------------------------------------------------------------------------
+void AsyncFile::WriteAt(
+    const void          *pBuffer,
+    size_t               size,
+    uint64_t             offset,
+    const AsyncCallback &callback)
+{
+    m_pIO->Submit({
+        AsyncOperation::Type::Write,
+        m_fd,
+        const_cast<void *>(pBuffer),
+        size,
+        offset,
+        callback
+    });
+}
+
+//------------------------------------------------------------------------------
+size_t AsyncFile::GetSize() const
+{
+    return Private::fd_size(m_fd, m_filename);
+}
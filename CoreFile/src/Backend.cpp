@@ -0,0 +1,148 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Backend.cpp                                                   //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Backend.h"
+// std
+#include <cerrno>
+#include <cstring>
+#include <ios>
+#include <stdexcept>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Variables                                                                  //
+//----------------------------------------------------------------------------//
+// nullptr means the POSIX one.
+static thread_local Backend *t_pBackend = nullptr;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Backend::~Backend()
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Interface                                                                  //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void Backend::CopyFile(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite)
+{
+    COREASSERT_THROW_IF_NOT(
+        src != dst,
+        std::invalid_argument,
+        "Source and destination are the same file - src: (%s) - dst: (%s)",
+        src.c_str(),
+        dst.c_str()
+    );
+
+    std::string contents;
+    COREASSERT_THROW_IF_NOT(
+        ReadFile(src, contents),
+        std::ios::failure,
+        "Failed to open file - filename: (%s) - error: (%s)",
+        src.c_str(),
+        strerror(ENOENT)
+    );
+    COREASSERT_THROW_IF_NOT(
+        overwrite || !IsFile(dst),
+        std::ios::failure,
+        "Failed to open file - filename: (%s) - error: (%s)",
+        dst.c_str(),
+        strerror(EEXIST)
+    );
+
+    WriteFile(
+        dst,
+        contents.data(),
+        contents.size(),
+        WriteMode::Truncate,
+        Durability::None
+    );
+}
+
+//------------------------------------------------------------------------------
+void Backend::MoveFile(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite)
+{
+    if(src == dst && IsFile(src))
+        return; // Same of rename(2).
+
+    CopyFile(src, dst, overwrite);
+    COREASSERT_THROW_IF_NOT(
+        DeleteFile(src),
+        std::runtime_error,
+        "Failed to remove moved file - src: (%s) - dst: (%s) - error: (%s)",
+        src.c_str(),
+        dst.c_str(),
+        strerror(ENOENT)
+    );
+}
+
+//------------------------------------------------------------------------------
+void Backend::ReplaceFile(
+    const std::string &src,
+    const std::string &dst,
+    const std::string &backup)
+{
+    if(!backup.empty())
+        CopyFile(dst, backup, true);
+
+    MoveFile(src, dst, true);
+}
+
+
+//----------------------------------------------------------------------------//
+// Selection                                                                  //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Backend& CoreFile::GetCurrentBackend()
+{
+    return (t_pBackend) ? *t_pBackend : GetPosixBackend();
+}
+
+//------------------------------------------------------------------------------
+ScopedBackend::ScopedBackend(Backend &backend) :
+    // Members.
+    m_pPrevious(t_pBackend)
+{
+    t_pBackend = &backend;
+}
+
+//------------------------------------------------------------------------------
+ScopedBackend::~ScopedBackend()
+{
+    t_pBackend = m_pPrevious;
+}
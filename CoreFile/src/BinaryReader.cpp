@@ -0,0 +1,288 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BinaryReader.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/BinaryReader.h"
+// std
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// COWNOTE(n2omatt): The size of blobs and strings comes from the data
+//   itself - A corrupt (or hostile) one can claim exabytes. Allocating it
+//   upfront would throw std::bad_alloc (or take all the memory) before
+//   the truncation is noticed, so the container grows in bounded chunks
+//   as the bytes arrive and a short input gets the normal end of file
+//   error from ReadBytes.
+template <typename Container>
+static void read_sized(BinaryReader &reader, Container &container, uint64_t size)
+{
+    const uint64_t kChunkSize = 1 << 20;
+
+    while(container.size() < size)
+    {
+        auto done = container.size();
+        auto step = static_cast<size_t>(std::min<uint64_t>(size - done, kChunkSize));
+
+        container.resize(done + step);
+        reader.ReadBytes(&container[done], step);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+BinaryReader::BinaryReader(const std::string &filename, size_t bufferSize) :
+    BinaryReader(Handle(filename, OpenMode::kRead), bufferSize)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+BinaryReader::BinaryReader(Handle handle, size_t bufferSize) :
+    // Members.
+    m_handle  (std::move(handle)),
+    m_pStream (nullptr),
+    m_buffer  (std::max<size_t>(bufferSize, 16)),
+    m_begin   (0),
+    m_end     (0),
+    m_position(0)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+BinaryReader::BinaryReader(std::istream &stream, size_t bufferSize) :
+    // Members.
+    m_handle  (),
+    m_pStream (&stream),
+    m_buffer  (std::max<size_t>(bufferSize, 16)),
+    m_begin   (0),
+    m_end     (0),
+    m_position(0)
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Primitives                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void BinaryReader::ReadBytes(void *pData, size_t size)
+{
+    auto p_curr = static_cast<byte_t *>(pData);
+
+    // What is already buffered.
+    auto buffered = std::min(size, Available());
+    if(buffered != 0)
+    {
+        std::memcpy(p_curr, &m_buffer[m_begin], buffered);
+
+        m_begin    += buffered;
+        m_position += buffered;
+        p_curr     += buffered;
+        size       -= buffered;
+    }
+
+    if(size == 0)
+        return;
+
+    // Big reads go straight to the caller's memory, small ones refill
+    // the buffer so the next fields are already there.
+    if(size >= m_buffer.size())
+    {
+        auto read = ReadFromSource(p_curr, size);
+        m_position += read;
+
+        COREASSERT_THROW_IF_NOT(
+            read == size,
+            std::runtime_error,
+            "Unexpected end of file - missing: (%zu) bytes",
+            size - read
+        );
+    }
+    else
+    {
+        Require(size);
+        std::memcpy(p_curr, &m_buffer[m_begin], size);
+
+        m_begin    += size;
+        m_position += size;
+    }
+}
+
+//------------------------------------------------------------------------------
+void BinaryReader::Skip(uint64_t size)
+{
+    while(size != 0)
+    {
+        if(Available() == 0)
+            Require(1);
+
+        auto step = static_cast<size_t>(
+            std::min<uint64_t>(size, Available())
+        );
+
+        m_begin    += step;
+        m_position += step;
+        size       -= step;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Variable Length                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+uint64_t BinaryReader::ReadVarUInt()
+{
+    uint64_t value = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        auto byte = Read<uint8_t>();
+
+        // The 10th byte only has room for the last bit.
+        if(shift == 63 && (byte & 0x7E) != 0)
+            break;
+
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0)
+            return value;
+    }
+
+    COREASSERT_THROW_IF_NOT(
+        false,
+        std::runtime_error,
+        "Malformed varint - position: (%llu)",
+        static_cast<unsigned long long>(m_position)
+    );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+int64_t BinaryReader::ReadVarInt()
+{
+    auto value = ReadVarUInt();
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+//------------------------------------------------------------------------------
+std::vector<byte_t> BinaryReader::ReadBlob()
+{
+    auto size = ReadVarUInt();
+
+    std::vector<byte_t> blob;
+    read_sized(*this, blob, size);
+
+    return blob;
+}
+
+//------------------------------------------------------------------------------
+std::string BinaryReader::ReadString()
+{
+    auto size = ReadVarUInt();
+
+    std::string str;
+    read_sized(*this, str, size);
+
+    return str;
+}
+
+
+//----------------------------------------------------------------------------//
+// State                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool BinaryReader::IsEndOfFile()
+{
+    return Available() == 0 && Fill() == 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Makes sure that size bytes (smaller than the buffer) are buffered.
+void BinaryReader::Require(size_t size)
+{
+    while(Available() < size)
+    {
+        COREASSERT_THROW_IF_NOT(
+            Fill() != 0,
+            std::runtime_error,
+            "Unexpected end of file - missing: (%zu) bytes",
+            size - Available()
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Moves the unread bytes to the front of the buffer and fills the rest.
+// Returns how many bytes were added - 0 means end of file.
+size_t BinaryReader::Fill()
+{
+    if(m_begin != 0)
+    {
+        std::memmove(&m_buffer[0], &m_buffer[m_begin], Available());
+        m_end  -= m_begin;
+        m_begin = 0;
+    }
+
+    auto read = ReadFromSource(&m_buffer[m_end], m_buffer.size() - m_end);
+    m_end += read;
+
+    return read;
+}
+
+//------------------------------------------------------------------------------
+size_t BinaryReader::ReadFromSource(void *pData, size_t size)
+{
+    if(!m_pStream)
+        return m_handle.Read(pData, size);
+
+    m_pStream->read(
+        static_cast<char *>(pData),
+        static_cast<std::streamsize>(size)
+    );
+
+    COREASSERT_THROW_IF_NOT(
+        !m_pStream->bad(),
+        std::runtime_error,
+        "Failed to read stream - position: (%llu)",
+        static_cast<unsigned long long>(m_position)
+    );
+
+    return static_cast<size_t>(m_pStream->gcount());
+}
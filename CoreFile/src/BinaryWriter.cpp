@@ -0,0 +1,247 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BinaryWriter.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/BinaryWriter.h"
+// std
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+BinaryWriter::BinaryWriter(const std::string &filename, size_t bufferSize) :
+    BinaryWriter(Handle(filename, OpenMode::kWrite), bufferSize)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+BinaryWriter::BinaryWriter(Handle handle, size_t bufferSize) :
+    // Members.
+    m_handle  (std::move(handle)),
+    m_pStream (nullptr),
+    m_buffer  (std::max<size_t>(bufferSize, 16)),
+    m_used    (0),
+    m_position(0)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+BinaryWriter::BinaryWriter(std::ostream &stream, size_t bufferSize) :
+    // Members.
+    m_handle  (),
+    m_pStream (&stream),
+    m_buffer  (std::max<size_t>(bufferSize, 16)),
+    m_used    (0),
+    m_position(0)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+BinaryWriter::~BinaryWriter()
+{
+    try {
+        FlushBuffer();
+    } catch(const std::exception &) {
+        // Destructors can't throw - Flush reports the errors.
+    }
+}
+
+//------------------------------------------------------------------------------
+BinaryWriter::BinaryWriter(BinaryWriter &&other) :
+    // Members.
+    m_handle  (std::move(other.m_handle)),
+    m_pStream (other.m_pStream),
+    m_buffer  (std::move(other.m_buffer)),
+    m_used    (other.m_used),
+    m_position(other.m_position)
+{
+    // Moved from writers have nothing to flush.
+    other.m_pStream = nullptr;
+    other.m_used    = 0;
+}
+
+//------------------------------------------------------------------------------
+BinaryWriter& BinaryWriter::operator =(BinaryWriter &&other)
+{
+    if(this != &other)
+    {
+        FlushBuffer();
+
+        m_handle   = std::move(other.m_handle);
+        m_pStream  = other.m_pStream;
+        m_buffer   = std::move(other.m_buffer);
+        m_used     = other.m_used;
+        m_position = other.m_position;
+
+        other.m_pStream = nullptr;
+        other.m_used    = 0;
+    }
+    return *this;
+}
+
+
+//----------------------------------------------------------------------------//
+// Primitives                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteBytes(const void *pData, size_t size)
+{
+    auto p_curr = static_cast<const byte_t *>(pData);
+    m_position += size;
+
+    // Fits in the buffer.
+    if(size <= Free())
+    {
+        std::memcpy(&m_buffer[m_used], p_curr, size);
+        m_used += size;
+        return;
+    }
+
+    // Big writes go straight from the caller's memory.
+    FlushBuffer();
+    if(size >= m_buffer.size())
+    {
+        WriteToSink(p_curr, size);
+        return;
+    }
+
+    std::memcpy(&m_buffer[0], p_curr, size);
+    m_used = size;
+}
+
+
+//----------------------------------------------------------------------------//
+// Variable Length                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteVarUInt(uint64_t value)
+{
+    byte_t bytes[10];
+    size_t size = 0;
+
+    while(value >= 0x80)
+    {
+        bytes[size++] = static_cast<byte_t>(value | 0x80);
+        value >>= 7;
+    }
+    bytes[size++] = static_cast<byte_t>(value);
+
+    WriteBytes(bytes, size);
+}
+
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteVarInt(int64_t value)
+{
+    auto bits = static_cast<uint64_t>(value);
+    WriteVarUInt((bits << 1) ^ (value < 0 ? ~uint64_t(0) : uint64_t(0)));
+}
+
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteBlob(const void *pData, size_t size)
+{
+    WriteVarUInt(size);
+    WriteBytes(pData, size);
+}
+
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteBlob(const std::vector<byte_t> &blob)
+{
+    WriteBlob(blob.data(), blob.size());
+}
+
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteString(const std::string &str)
+{
+    WriteBlob(str.data(), str.size());
+}
+
+
+//----------------------------------------------------------------------------//
+// State                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void BinaryWriter::Flush()
+{
+    FlushBuffer();
+
+    if(m_pStream)
+    {
+        m_pStream->flush();
+        COREASSERT_THROW_IF_NOT(
+            !m_pStream->bad(),
+            std::runtime_error,
+            "Failed to flush stream - position: (%llu)",
+            static_cast<unsigned long long>(m_position)
+        );
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void BinaryWriter::FlushBuffer()
+{
+    if(m_used == 0)
+        return;
+
+    // Reset before writing, so a failure doesn't send the same bytes
+    // again from the destructor.
+    auto size = m_used;
+    m_used    = 0;
+
+    WriteToSink(&m_buffer[0], size);
+}
+
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteToSink(const void *pData, size_t size)
+{
+    if(!m_pStream)
+    {
+        m_handle.Write(pData, size);
+        return;
+    }
+
+    m_pStream->write(
+        static_cast<const char *>(pData),
+        static_cast<std::streamsize>(size)
+    );
+
+    COREASSERT_THROW_IF_NOT(
+        !m_pStream->bad(),
+        std::runtime_error,
+        "Failed to write stream - position: (%llu)",
+        static_cast<unsigned long long>(m_position)
+    );
+}
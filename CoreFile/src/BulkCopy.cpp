@@ -0,0 +1,268 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BulkCopy.cpp                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/BulkCopy.h"
+// std
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+// CoreFile
+#include "../include/Backend.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+typedef void (*JobFunc)(const std::string &, const std::string &, bool);
+
+// The jobs dealt to a worker - Indexes of the jobs vector.
+struct WorkQueue
+{
+    std::mutex         mutex;
+    std::deque<size_t> jobs;
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Takes the next job of the worker - Returns false when there's none left.
+// COWNOTE(n2omatt): The queues are sorted by size, biggest first.
+//   Owners take from the front and thieves from the back, so the big
+//   files stay with their owners and the steals are cheap to finish.
+static bool take_job(
+    std::vector<std::unique_ptr<WorkQueue>> &queues,
+    size_t                                   self,
+    size_t                                  &index)
+{
+    {
+        auto &own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if(!own.jobs.empty())
+        {
+            index = own.jobs.front();
+            own.jobs.pop_front();
+            return true;
+        }
+    }
+
+    for(size_t i = 1; i < queues.size(); ++i)
+    {
+        auto &victim = *queues[(self + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if(!victim.jobs.empty())
+        {
+            index = victim.jobs.back();
+            victim.jobs.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+static std::vector<std::string> run_bulk(
+    const std::vector<BulkJob> &jobs,
+    bool                        overwrite,
+    const BulkProgressCallback &onProgress,
+    size_t                      threads,
+    JobFunc                     func)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    std::vector<std::string> errors(jobs.size());
+    if(jobs.empty())
+        return errors;
+
+    // COWNOTE(n2omatt): The backend is per thread - The workers must use
+    //   the caller's one, otherwise a ScopedBackend around CopyMany would
+    //   only be seen by the calling thread.
+    auto &backend = GetCurrentBackend();
+
+    //--------------------------------------------------------------------------
+    // Size all the sources upfront - The sizes are used to order the jobs
+    // and for the progress.
+    std::vector<uint64_t> sizes;
+    sizes.reserve(jobs.size());
+
+    auto bytes_total = uint64_t(0);
+    for(const auto &job : jobs)
+    {
+        sizes.push_back(backend.GetFileSize(job.src)); // Zero for the missing ones.
+        bytes_total += sizes.back();
+    }
+
+    std::vector<size_t> order(jobs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return sizes[a] > sizes[b];
+    });
+
+    //--------------------------------------------------------------------------
+    // Deal the jobs - Every queue gets its share of big and small ones.
+    if(threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, jobs.size());
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    for(size_t i = 0; i < threads; ++i)
+        queues.emplace_back(new WorkQueue());
+    for(size_t i = 0; i < order.size(); ++i)
+        queues[i % threads]->jobs.push_back(order[i]);
+
+    //--------------------------------------------------------------------------
+    // Workers.
+    std::atomic<size_t>   files_done  (0);
+    std::atomic<size_t>   files_failed(0);
+    std::atomic<uint64_t> bytes_done  (0);
+
+    std::mutex              done_mutex;
+    std::condition_variable done_cv;
+    auto                    workers_left = threads;
+
+    auto worker = [&](size_t self) {
+        ScopedBackend scoped_backend(backend);
+
+        size_t index = 0;
+        while(take_job(queues, self, index))
+        {
+            try {
+                func(jobs[index].src, jobs[index].dst, overwrite);
+            } catch(const std::exception &e) {
+                errors[index] = e.what();
+                ++files_failed;
+            } catch(...) {
+                errors[index] = "Unknown error";
+                ++files_failed;
+            }
+
+            bytes_done += sizes[index];
+            ++files_done;
+        }
+
+        std::lock_guard<std::mutex> lock(done_mutex);
+        --workers_left;
+        done_cv.notify_all();
+    };
+
+    // Without progress the calling thread is one of the workers.
+    if(!onProgress)
+    {
+        std::vector<std::thread> pool;
+        for(size_t i = 1; i < threads; ++i)
+            pool.emplace_back(worker, i);
+
+        worker(0);
+        for(auto &thread : pool)
+            thread.join();
+
+        return errors;
+    }
+
+    //--------------------------------------------------------------------------
+    // With progress the calling thread reports it while the others work.
+    auto start  = Clock::now();
+    auto report = [&]() {
+        BulkProgress progress;
+        progress.filesDone   = files_done;
+        progress.filesFailed = files_failed;
+        progress.filesTotal  = jobs.size();
+        progress.bytesDone   = bytes_done;
+        progress.bytesTotal  = bytes_total;
+        progress.elapsed     = std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - start
+        );
+
+        auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        progress.bytesPerSecond = (seconds > 0)
+            ? static_cast<double>(progress.bytesDone) / seconds
+            : 0;
+
+        onProgress(progress);
+    };
+
+    std::vector<std::thread> pool;
+    for(size_t i = 0; i < threads; ++i)
+        pool.emplace_back(worker, i);
+
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        while(!done_cv.wait_for(lock, kBulkProgressInterval, [&]() { return workers_left == 0; }))
+        {
+            lock.unlock();
+            report();
+            lock.lock();
+        }
+    }
+
+    for(auto &thread : pool)
+        thread.join();
+
+    report();
+    return errors;
+}
+
+//------------------------------------------------------------------------------
+static void copy_job(const std::string &src, const std::string &dst, bool overwrite)
+{
+    Copy(src, dst, overwrite);
+}
+
+//------------------------------------------------------------------------------
+static void move_job(const std::string &src, const std::string &dst, bool overwrite)
+{
+    Move(src, dst, overwrite);
+}
+
+
+//----------------------------------------------------------------------------//
+// Bulk Copy / Move                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<std::string> CoreFile::CopyMany(
+    const std::vector<BulkJob> &jobs,
+    bool                        overwrite  /* = false   */,
+    BulkProgressCallback        onProgress /* = nullptr */,
+    size_t                      threads    /* = 0       */)
+{
+    return run_bulk(jobs, overwrite, onProgress, threads, &copy_job);
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> CoreFile::MoveMany(
+    const std::vector<BulkJob> &jobs,
+    bool                        overwrite  /* = false   */,
+    BulkProgressCallback        onProgress /* = nullptr */,
+    size_t                      threads    /* = 0       */)
+{
+    return run_bulk(jobs, overwrite, onProgress, threads, &move_job);
+}
@@ -0,0 +1,758 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Compression.cpp                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+
+// Header
+#include "../include/Compression.h"
+// std
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+// POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+// zstd
+#if COREFILE_ZSTD
+    #include <zstd.h>
+#endif
+// CoreFile
+#include "../include/Backend.h"
+#include "../include/Endian.h"
+#include "private/Instrumentation_Scope.h"
+#include "private/Line_Helpers.h"
+#include "private/Lz4_Codec.h"
+#include "private/Parallel_For.h"
+#include "private/Posix_Helpers.h"
+// CoreFS
+#include "CoreFS/CoreFS.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+static const uint32_t kLz4Magic       = 0x184D2204;
+static const uint32_t kZstdMagic      = 0xFD2FB528;
+static const uint32_t kSkippableMagic = 0x184D2A50; // Low 4 bits are free.
+static const uint32_t kSkippableMask  = 0xFFFFFFF0;
+
+// LZ4 frame descriptor - Version 01, independent blocks, content size
+// and content checksum. Blocks of 4MB (kLz4BlockSize).
+static const uint8_t  kLz4Flags            = 0x6C;
+static const uint8_t  kLz4BlockDescriptor  = 0x70;
+static const uint32_t kLz4UncompressedFlag = 0x80000000;
+
+// How much of the file is read at once.
+static const size_t kChunkSize = 1024 * 1024;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): The compressed input, either read from a fd in
+//   chunks or already in memory (when it comes from another Backend).
+//   The frame decoders only see the bytes not consumed yet, and ask
+//   for more with Fill.
+class InputChunks
+{
+public:
+    InputChunks(int fd, const std::string &filename) :
+        // Members.
+        m_fd      (fd),
+        m_filename(filename),
+        m_offset  (0),
+        m_pData   (nullptr),
+        m_size    (0),
+        m_eof     (false)
+    {
+        // Empty...
+    }
+
+    InputChunks(const char *pData, size_t size, const std::string &filename) :
+        // Members.
+        m_fd      (-1),
+        m_filename(filename),
+        m_offset  (0),
+        m_pData   (pData),
+        m_size    (size),
+        m_eof     (true)
+    {
+        // Empty...
+    }
+
+    InputChunks(const InputChunks &)            = delete;
+    InputChunks& operator =(const InputChunks &) = delete;
+
+public:
+    const char* Data() const { return m_pData; }
+    size_t      Size() const { return m_size;  }
+
+    // Makes at least size bytes available - false if the input ends
+    // before that.
+    bool Fill(size_t size)
+    {
+        if(m_size >= size)
+            return true;
+        if(m_eof)
+            return false;
+
+        // Move what is left to the front and read after it.
+        if(m_size > 0 && m_pData != m_buffer.data())
+            memmove(m_buffer.data(), m_pData, m_size);
+        if(m_buffer.size() < size)
+            m_buffer.resize(std::max(size, kChunkSize));
+
+        m_pData = m_buffer.data();
+
+        auto wanted = m_buffer.size() - m_size;
+        auto n      = Private::pread_all(
+            m_fd,
+            m_buffer.data() + m_size,
+            wanted,
+            m_offset,
+            m_filename
+        );
+        COREFILE_INSTRUMENT_BYTES(n);
+
+        m_offset += n;
+        m_size   += n;
+        m_eof     = (n < wanted);
+
+        return m_size >= size;
+    }
+
+    void Consume(size_t size)
+    {
+        m_pData += size;
+        m_size  -= size;
+    }
+
+private:
+    int                m_fd;
+    const std::string &m_filename;
+    uint64_t           m_offset;
+
+    std::vector<char> m_buffer;
+    const char       *m_pData;
+    size_t            m_size;
+    bool              m_eof;
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static uint32_t read_u32_le(const void *pData)
+{
+    uint32_t value;
+    memcpy(&value, pData, sizeof(value));
+    return ConvertEndian<Endian::Little>(value);
+}
+
+//------------------------------------------------------------------------------
+static uint64_t read_u64_le(const void *pData)
+{
+    uint64_t value;
+    memcpy(&value, pData, sizeof(value));
+    return ConvertEndian<Endian::Little>(value);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+static void append_le(std::string &out, T value)
+{
+    value = ConvertEndian<Endian::Little>(value);
+    out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+//------------------------------------------------------------------------------
+static void check_frame(bool cond, const std::string &filename, const char *pError)
+{
+    COREASSERT_THROW_IF_NOT(
+        cond,
+        std::runtime_error,
+        "Failed to decompress file - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        pError
+    );
+}
+
+//------------------------------------------------------------------------------
+template <typename Container>
+static char* container_data(Container &container)
+{
+    return reinterpret_cast<char *>(&container[0]);
+}
+
+
+//----------------------------------------------------------------------------//
+// Decompress                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Decodes a single LZ4 frame (the magic is already consumed) appending
+// it at out[pos] - pos is advanced.
+template <typename Container>
+static void decode_lz4_frame(
+    InputChunks       &input,
+    Container         &out,
+    size_t            &pos,
+    const std::string &filename)
+{
+    check_frame(input.Fill(2), filename, "truncated lz4 frame header");
+
+    auto flags      = uint8_t(input.Data()[0]);
+    auto descriptor = uint8_t(input.Data()[1]);
+    check_frame(
+        (flags >> 6) == 1 && (flags & 0x02) == 0 && (descriptor & 0x8F) == 0,
+        filename,
+        "unsupported lz4 frame version"
+    );
+
+    auto has_block_checksum   = (flags & 0x10) != 0;
+    auto has_content_size     = (flags & 0x08) != 0;
+    auto has_content_checksum = (flags & 0x04) != 0;
+    auto has_dictionary       = (flags & 0x01) != 0;
+    check_frame(!has_dictionary, filename, "lz4 dictionaries aren't supported");
+
+    auto block_size_id = (descriptor >> 4) & 0x07;
+    check_frame(block_size_id >= 4, filename, "invalid lz4 block size");
+    auto max_block_size = size_t(1) << (8 + 2 * block_size_id);
+
+    auto header_size = size_t(2) + (has_content_size ? 8 : 0);
+    check_frame(input.Fill(header_size + 1), filename, "truncated lz4 frame header");
+
+    auto header_checksum = (Private::xxh32(input.Data(), header_size, 0) >> 8) & 0xFF;
+    check_frame(
+        header_checksum == uint8_t(input.Data()[header_size]),
+        filename,
+        "lz4 frame header checksum mismatch"
+    );
+
+    auto content_size = (has_content_size) ? read_u64_le(input.Data() + 2) : 0;
+    input.Consume(header_size + 1);
+
+    // COWNOTE(n2omatt): Linked blocks reference the previous ones of
+    //   the same frame, so everything is decoded relative to its start.
+    auto frame_start = pos;
+    while(true)
+    {
+        check_frame(input.Fill(4), filename, "truncated lz4 block");
+        auto block_header = read_u32_le(input.Data());
+        input.Consume(4);
+
+        if(block_header == 0) // EndMark
+            break;
+
+        auto block_size = size_t(block_header & ~kLz4UncompressedFlag);
+        auto extra      = size_t(has_block_checksum ? 4 : 0);
+        check_frame(block_size <= max_block_size, filename, "invalid lz4 block size");
+        check_frame(input.Fill(block_size + extra), filename, "truncated lz4 block");
+
+        if(has_block_checksum)
+        {
+            check_frame(
+                Private::xxh32(input.Data(), block_size, 0)
+                    == read_u32_le(input.Data() + block_size),
+                filename,
+                "lz4 block checksum mismatch"
+            );
+        }
+
+        if(out.size() < pos + max_block_size)
+            out.resize(std::max(out.size() * 2, pos + max_block_size));
+
+        if(block_header & kLz4UncompressedFlag)
+        {
+            memcpy(container_data(out) + pos, input.Data(), block_size);
+            pos += block_size;
+        }
+        else
+        {
+            auto n = Private::lz4_decompress_block(
+                input.Data(),
+                block_size,
+                container_data(out) + frame_start,
+                pos - frame_start,
+                out.size() - frame_start
+            );
+            check_frame(n != SIZE_MAX, filename, "corrupted lz4 block");
+            pos += n;
+        }
+
+        input.Consume(block_size + extra);
+    }
+
+    if(has_content_checksum)
+    {
+        check_frame(input.Fill(4), filename, "truncated lz4 frame");
+        check_frame(
+            Private::xxh32(container_data(out) + frame_start, pos - frame_start, 0)
+                == read_u32_le(input.Data()),
+            filename,
+            "lz4 content checksum mismatch"
+        );
+        input.Consume(4);
+    }
+
+    check_frame(
+        !has_content_size || content_size == pos - frame_start,
+        filename,
+        "lz4 content size mismatch"
+    );
+}
+
+//------------------------------------------------------------------------------
+template <typename Container>
+static void decode_lz4(
+    InputChunks       &input,
+    Container         &out,
+    const std::string &filename)
+{
+    auto pos = size_t(0);
+    while(input.Fill(1))
+    {
+        check_frame(input.Fill(4), filename, "truncated frame");
+        auto magic = read_u32_le(input.Data());
+        input.Consume(4);
+
+        if(magic == kLz4Magic)
+        {
+            decode_lz4_frame(input, out, pos, filename);
+            continue;
+        }
+
+        check_frame(
+            (magic & kSkippableMask) == kSkippableMagic,
+            filename,
+            "unknown frame after lz4 frame"
+        );
+        check_frame(input.Fill(4), filename, "truncated skippable frame");
+        auto skip = size_t(read_u32_le(input.Data()));
+        input.Consume(4);
+
+        while(skip > 0)
+        {
+            check_frame(input.Fill(1), filename, "truncated skippable frame");
+            auto n = std::min(skip, input.Size());
+            input.Consume(n);
+            skip -= n;
+        }
+    }
+
+    out.resize(pos);
+}
+
+#if COREFILE_ZSTD
+//------------------------------------------------------------------------------
+// zstd decodes concatenated and skippable frames by itself.
+template <typename Container>
+static void decode_zstd(
+    InputChunks       &input,
+    Container         &out,
+    const std::string &filename)
+{
+    std::unique_ptr<ZSTD_DStream, size_t (*)(ZSTD_DStream *)> p_stream(
+        ZSTD_createDStream(),
+        ZSTD_freeDStream
+    );
+    check_frame(p_stream != nullptr, filename, "failed to create zstd stream");
+    ZSTD_initDStream(p_stream.get());
+
+    auto out_step  = ZSTD_DStreamOutSize();
+    auto pos       = size_t(0);
+    auto remaining = size_t(0); // 0 when the last frame is complete.
+
+    while(input.Fill(1))
+    {
+        ZSTD_inBuffer in_buffer = { input.Data(), input.Size(), 0 };
+
+        // COWNOTE(n2omatt): A full output may still have data inside the
+        //   decoder - Unless the frame is complete (remaining is 0), then
+        //   calling it again would start waiting for the next frame.
+        auto output_full = false;
+        while(in_buffer.pos < in_buffer.size || (output_full && remaining != 0))
+        {
+            if(out.size() - pos < out_step)
+                out.resize(std::max(out.size() * 2, pos + out_step));
+
+            ZSTD_outBuffer out_buffer = { container_data(out), out.size(), pos };
+            remaining = ZSTD_decompressStream(p_stream.get(), &out_buffer, &in_buffer);
+            check_frame(!ZSTD_isError(remaining), filename, ZSTD_getErrorName(remaining));
+
+            output_full = (out_buffer.pos == out_buffer.size);
+            pos         = out_buffer.pos;
+        }
+
+        input.Consume(in_buffer.pos);
+    }
+
+    check_frame(remaining == 0, filename, "truncated zstd frame");
+    out.resize(pos);
+}
+#endif // COREFILE_ZSTD
+
+//------------------------------------------------------------------------------
+template <typename Container>
+static void decompress(
+    InputChunks       &input,
+    Container         &out,
+    const std::string &filename)
+{
+    auto compression = Compression::None;
+    if(input.Fill(4))
+        compression = DetectCompression(input.Data(), input.Size());
+
+    if(compression == Compression::Lz4)
+    {
+        decode_lz4(input, out, filename);
+    }
+    else if(compression == Compression::Zstd)
+    {
+    #if COREFILE_ZSTD
+        decode_zstd(input, out, filename);
+    #else
+        check_frame(false, filename, "zstd support isn't compiled in");
+    #endif
+    }
+    else
+    {
+        // Plain file - Just the chunks.
+        out.clear();
+        while(input.Fill(1))
+        {
+            auto p_data = input.Data();
+            out.insert(out.end(), p_data, p_data + input.Size());
+            input.Consume(input.Size());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Returns false if the file doesn't exist or isn't a regular file, same
+// of Backend::ReadFile.
+template <typename Container>
+static bool read_decompressed(const std::string &filename, Container &out)
+{
+    out.clear();
+
+    // COWNOTE(n2omatt): Other backends only give the whole file - It's
+    //   decompressed from memory then.
+    auto &backend = GetCurrentBackend();
+    if(&backend != &GetPosixBackend())
+    {
+        std::string contents;
+        if(!backend.ReadFile(filename, contents))
+            return false;
+
+        InputChunks input(contents.data(), contents.size(), filename);
+        decompress(input, out, filename);
+        return true;
+    }
+
+    auto fd = Private::try_open_fd(filename, O_RDONLY);
+    if(!fd.IsValid())
+        return false;
+
+    COREFILE_COUNT_SYSCALL();
+    struct stat st;
+    if(fstat(fd.Get(), &st) != 0 || !S_ISREG(st.st_mode))
+        return false;
+
+    InputChunks input(fd.Get(), filename);
+    decompress(input, out, filename);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Compress                                                                   //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static std::string encode_lz4(const char *pData, size_t size, size_t threads)
+{
+    // Each block is compressed on its own - In parallel.
+    auto block_count = (size + kLz4BlockSize - 1) / kLz4BlockSize;
+    std::vector<std::string> blocks(block_count);
+
+    Private::parallel_for(block_count, threads, 1, [&](size_t index) {
+        auto p_src  = pData + index * kLz4BlockSize;
+        auto length = std::min(kLz4BlockSize, size - index * kLz4BlockSize);
+
+        auto &block = blocks[index];
+        block.resize(4 + length);
+
+        // Stored as is when it doesn't get any smaller.
+        auto compressed = Private::lz4_compress_block(p_src, length, &block[4], length);
+        auto header     = uint32_t(compressed);
+        if(compressed == 0)
+        {
+            memcpy(&block[4], p_src, length);
+            compressed = length;
+            header     = uint32_t(length) | kLz4UncompressedFlag;
+        }
+
+        header = ConvertEndian<Endian::Little>(header);
+        memcpy(&block[0], &header, sizeof(header));
+        block.resize(4 + compressed);
+    });
+
+    auto frame_size = size_t(4 + 11 + 4 + 4);
+    for(const auto &block : blocks)
+        frame_size += block.size();
+
+    std::string frame;
+    frame.reserve(frame_size);
+
+    append_le<uint32_t>(frame, kLz4Magic);
+    frame.push_back(char(kLz4Flags));
+    frame.push_back(char(kLz4BlockDescriptor));
+    append_le<uint64_t>(frame, size);
+    frame.push_back(char((Private::xxh32(frame.data() + 4, 10, 0) >> 8) & 0xFF));
+
+    for(const auto &block : blocks)
+        frame.append(block);
+
+    append_le<uint32_t>(frame, 0); // EndMark
+    append_le<uint32_t>(frame, Private::xxh32(pData, size, 0));
+
+    return frame;
+}
+
+#if COREFILE_ZSTD
+//------------------------------------------------------------------------------
+static std::string encode_zstd(const char *pData, size_t size, size_t threads)
+{
+    std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx *)> p_context(
+        ZSTD_createCCtx(),
+        ZSTD_freeCCtx
+    );
+    COREASSERT_THROW_IF_NOT(
+        p_context != nullptr,
+        std::runtime_error,
+        "Failed to create zstd context - size: (%zu)",
+        size
+    );
+
+    ZSTD_CCtx_setParameter(p_context.get(), ZSTD_c_checksumFlag, 1);
+
+    // COWNOTE(n2omatt): Same threshold of the LZ4 blocks. It fails on a
+    //   libzstd built without threads - Then it's just single threaded.
+    if(threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    if(threads > 1 && size >= 2 * kLz4BlockSize)
+        ZSTD_CCtx_setParameter(p_context.get(), ZSTD_c_nbWorkers, int(threads));
+
+    std::string frame(ZSTD_compressBound(size), '\0');
+    auto n = ZSTD_compress2(p_context.get(), &frame[0], frame.size(), pData, size);
+    COREASSERT_THROW_IF_NOT(
+        !ZSTD_isError(n),
+        std::runtime_error,
+        "Failed to compress - error: (%s)",
+        ZSTD_getErrorName(n)
+    );
+
+    frame.resize(n);
+    return frame;
+}
+#endif // COREFILE_ZSTD
+
+
+//----------------------------------------------------------------------------//
+// Detect                                                                     //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Compression CoreFile::DetectCompression(const void *pData, size_t size)
+{
+    auto p_data = static_cast<const char *>(pData);
+    auto offset = size_t(0);
+
+    while(size - offset >= 4)
+    {
+        auto magic = read_u32_le(p_data + offset);
+        if(magic == kLz4Magic)
+            return Compression::Lz4;
+        if(magic == kZstdMagic)
+            return Compression::Zstd;
+
+        // Look after the skippable frames - Both formats use them.
+        if((magic & kSkippableMask) != kSkippableMagic || size - offset < 8)
+            break;
+        offset += 8 + size_t(read_u32_le(p_data + offset + 4));
+        if(offset > size)
+            break;
+    }
+
+    return Compression::None;
+}
+
+//------------------------------------------------------------------------------
+Compression CoreFile::DetectCompression(const std::string &filename)
+{
+    std::string contents;
+    if(&GetCurrentBackend() != &GetPosixBackend())
+    {
+        GetCurrentBackend().ReadFile(filename, contents);
+        return DetectCompression(contents.data(), contents.size());
+    }
+
+    auto fd = Private::try_open_fd(filename, O_RDONLY);
+    if(!fd.IsValid())
+        return Compression::None;
+
+    InputChunks input(fd.Get(), filename);
+    input.Fill(4);
+
+    return DetectCompression(input.Data(), input.Size());
+}
+
+
+//----------------------------------------------------------------------------//
+// Read                                                                       //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<byte_t> CoreFile::ReadAllBytesDecompressed(const std::string &filename)
+{
+    COREFILE_INSTRUMENT(IoOperation::ReadAll);
+
+    std::vector<byte_t> ret_val;
+    read_decompressed(filename, ret_val);
+
+    return ret_val;
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> CoreFile::ReadAllLinesDecompressed(
+    const std::string &filename)
+{
+    COREFILE_INSTRUMENT(IoOperation::ReadAll);
+
+    std::vector<std::string> ret_val;
+
+    std::string contents;
+    if(!read_decompressed(filename, contents))
+        return ret_val;
+
+    return Private::split_lines(contents);
+}
+
+//------------------------------------------------------------------------------
+std::string CoreFile::ReadAllTextDecompressed(const std::string &filename)
+{
+    COREFILE_INSTRUMENT(IoOperation::ReadAll);
+
+    std::string ret_val;
+    read_decompressed(filename, ret_val);
+
+    return ret_val;
+}
+
+
+//----------------------------------------------------------------------------//
+// Write                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllBytesCompressed(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    Compression        compression /* = Compression::Lz4    */,
+    size_t             threads     /* = 0                   */,
+    WriteMode          mode        /* = WriteMode::Truncate */,
+    Durability         durability  /* = Durability::None    */)
+{
+    COREFILE_INSTRUMENT(IoOperation::WriteAll);
+
+    auto p_data = static_cast<const char *>(pData);
+    if(compression == Compression::None)
+    {
+        GetCurrentBackend().WriteFile(filename, p_data, size, mode, durability);
+        return;
+    }
+
+    std::string frame;
+    if(compression == Compression::Lz4)
+    {
+        frame = encode_lz4(p_data, size, threads);
+    }
+    else
+    {
+    #if COREFILE_ZSTD
+        frame = encode_zstd(p_data, size, threads);
+    #else
+        COREASSERT_THROW_IF_NOT(
+            false,
+            std::invalid_argument,
+            "zstd support isn't compiled in - filename: (%s)",
+            filename.c_str()
+        );
+    #endif
+    }
+
+    GetCurrentBackend().WriteFile(filename, frame.data(), frame.size(), mode, durability);
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllLinesCompressed(
+    const std::string              &filename,
+    const std::vector<std::string> &lines,
+    Compression                     compression /* = Compression::Lz4    */,
+    size_t                          threads     /* = 0                   */,
+    WriteMode                       mode        /* = WriteMode::Truncate */,
+    Durability                      durability  /* = Durability::None    */)
+{
+    auto contents = Private::join_lines(lines);
+
+    WriteAllBytesCompressed(
+        filename,
+        contents.data(),
+        contents.size(),
+        compression,
+        threads,
+        mode,
+        durability
+    );
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllTextCompressed(
+    const std::string &filename,
+    const std::string &contents,
+    Compression        compression /* = Compression::Lz4    */,
+    size_t             threads     /* = 0                   */,
+    WriteMode          mode        /* = WriteMode::Truncate */,
+    Durability         durability  /* = Durability::None    */)
+{
+    WriteAllBytesCompressed(
+        filename,
+        contents.data(),
+        contents.size(),
+        compression,
+        threads,
+        mode,
+        durability
+    );
+}
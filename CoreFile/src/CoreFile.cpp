@@ -22,13 +22,18 @@
 #include "../include/CoreFile.h"
 // std
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
-#include <iterator>
-#include <sstream>
 // CoreFile
+#include "../include/Backend.h"
 #include "../include/Config.h"
+#include "../include/FileTime.h"
+#include "private/Copy_Engine.h"
+#include "private/Instrumentation_Scope.h"
+#include "private/Line_Helpers.h"
+#include "private/Posix_Helpers.h"
 // CoreFS
 #include "CoreFS/CoreFS.h"
 // CoreAssert
@@ -42,15 +47,309 @@
 // Helper Functions                                                           //
 //----------------------------------------------------------------------------//
 // COWNOTE(n2omatt): Convert the time_t value to struct tm
-//   This is needed because the pointers that localtime(3) or gmtime(3)
-//   return might be reused in subsequent calls to the functions.
+//   This used to go through localtime(3) / gmtime(3), which return a
+//   shared static buffer and take the glibc timezone lock - Now it's
+//   reentrant and scales with the threads. @see FileTime.h
 CoreFile::tm_t time_t_to_tm_t(time_t time, bool local)
 {
-    auto p_tm = (local) ? localtime(&time) : gmtime(&time);
-    CoreFile::tm_t ret_tm = {0};
-    memcpy(&ret_tm, p_tm, sizeof(ret_tm));
+    return (local) ? CoreFile::ToLocalTime(time) : CoreFile::ToUtcTime(time);
+}
+
+//------------------------------------------------------------------------------
+// Copies src to dst streaming the contents in kernel whenever possible.
+// The destination keeps the permission bits (and optionally the times)
+// of source and it's only created exclusively when we can't overwrite it.
+void copy_file(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite,
+    bool               keepTimes)
+{
+    auto src_fd   = CoreFile::Private::open_fd(src, O_RDONLY);
+    auto src_stat = CoreFile::Private::fd_stat(src_fd.Get(), src);
+
+    auto dst_flags = O_WRONLY | O_CREAT | (overwrite ? 0 : O_EXCL);
+    auto dst_fd    = CoreFile::Private::open_fd(dst, dst_flags, src_stat.st_mode & 07777);
+
+    // COWNOTE(n2omatt): The destination is only truncated after we make
+    //   sure that it isn't the source itself - Otherwise we would destroy
+    //   the contents that we're trying to copy.
+    auto dst_stat = CoreFile::Private::fd_stat(dst_fd.Get(), dst);
+    COREASSERT_THROW_IF_NOT(
+        !(src_stat.st_dev == dst_stat.st_dev && src_stat.st_ino == dst_stat.st_ino),
+        std::invalid_argument,
+        "Source and destination are the same file - src: (%s) - dst: (%s)",
+        src.c_str(),
+        dst.c_str()
+    );
+
+    try {
+        COREASSERT_THROW_IF_NOT(
+            ftruncate(dst_fd.Get(), 0) == 0,
+            std::runtime_error,
+            "Failed to truncate destination - dst: (%s) - error: (%s)",
+            dst.c_str(),
+            strerror(errno)
+        );
+
+        auto copied = CoreFile::Private::copy_fd(
+            src_fd.Get(),
+            dst_fd.Get(),
+            static_cast<size_t>(src_stat.st_size),
+            src,
+            dst
+        );
+        COREFILE_INSTRUMENT_BYTES(copied);
+
+        if(keepTimes)
+        {
+            struct timespec times[2] = { src_stat.st_atim, src_stat.st_mtim };
+            COREFILE_COUNT_SYSCALL();
+            COREASSERT_THROW_IF_NOT(
+                futimens(dst_fd.Get(), times) == 0,
+                std::runtime_error,
+                "Failed to set file times - dst: (%s) - error: (%s)",
+                dst.c_str(),
+                strerror(errno)
+            );
+        }
+    } catch(...) {
+        // Don't leave a half copied file behind when it was ours.
+        if(!overwrite)
+            unlink(dst.c_str());
+        throw;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Renames src to dst - Returns 0 or the errno of the failure (EEXIST
+// if dst exists and overwrite is false).
+int rename_file(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite)
+{
+    if(!overwrite)
+    {
+#if defined(RENAME_NOREPLACE)
+        COREFILE_COUNT_SYSCALL();
+        if(renameat2(AT_FDCWD, src.c_str(), AT_FDCWD, dst.c_str(), RENAME_NOREPLACE) == 0)
+            return 0;
+        if(errno != EINVAL && errno != ENOSYS)
+            return errno;
+#endif // defined(RENAME_NOREPLACE)
+
+        // COWNOTE(n2omatt): The filesystem (or the libc) doesn't know
+        //   RENAME_NOREPLACE - Checking first is racy, but the best we can.
+        COREFILE_COUNT_SYSCALL();
+        struct stat st;
+        if(lstat(dst.c_str(), &st) == 0)
+            return EEXIST;
+    }
+
+    COREFILE_COUNT_SYSCALL();
+    if(rename(src.c_str(), dst.c_str()) != 0)
+        return errno;
+
+    return 0;
+}
 
-    return ret_tm;
+//------------------------------------------------------------------------------
+// Moves src to dst - Across filesystems it's copied and removed.
+void move_file(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite)
+{
+    auto error = rename_file(src, dst, overwrite);
+
+    // COWNOTE(n2omatt): rename(2) can't cross filesystems - Do what
+    //   mv(1) does: copy (keeping the times) and remove the source.
+    if(error == EXDEV)
+    {
+        copy_file(src, dst, overwrite, true);
+
+        COREFILE_COUNT_SYSCALL();
+        COREASSERT_THROW_IF_NOT(
+            unlink(src.c_str()) == 0,
+            std::runtime_error,
+            "Failed to remove moved file - src: (%s) - dst: (%s) - error: (%s)",
+            src.c_str(),
+            dst.c_str(),
+            strerror(errno)
+        );
+        return;
+    }
+
+    COREASSERT_THROW_IF_NOT(
+        error != EEXIST,
+        std::ios::failure,
+        "Failed to move file - src: (%s) - dst: (%s) - error: (%s)",
+        src.c_str(),
+        dst.c_str(),
+        strerror(error)
+    );
+    COREASSERT_THROW_IF_NOT(
+        error == 0,
+        std::runtime_error,
+        "Failed to move file - src: (%s) - dst: (%s) - error: (%s)",
+        src.c_str(),
+        dst.c_str(),
+        strerror(error)
+    );
+}
+
+//------------------------------------------------------------------------------
+// Renames src over dst, optionally keeping a backup of dst.
+// A hard link keeps dst in place until the rename, so there's no moment
+// where dst doesn't exist - Filesystems without hard links get a copy
+// instead.
+void replace_file(
+    const std::string &src,
+    const std::string &dst,
+    const std::string &backup)
+{
+    if(!backup.empty())
+    {
+        COREFILE_COUNT_SYSCALL();
+        unlink(backup.c_str());
+
+        COREFILE_COUNT_SYSCALL();
+        if(link(dst.c_str(), backup.c_str()) != 0)
+            copy_file(dst, backup, true, false);
+    }
+
+    COREFILE_COUNT_SYSCALL();
+    COREASSERT_THROW_IF_NOT(
+        rename(src.c_str(), dst.c_str()) == 0,
+        std::runtime_error,
+        "Failed to replace file - src: (%s) - dst: (%s) - error: (%s)",
+        src.c_str(),
+        dst.c_str(),
+        strerror(errno)
+    );
+
+    CoreFile::Private::fsync_parent_directory(dst);
+}
+
+// COWNOTE(n2omatt): Reads the whole file straight into the container
+//   storage with a single open(2) + fstat(2) and as few read(2) as
+//   possible. Returns false if the file doesn't exist or isn't a
+//   regular file, so the callers keep the old "empty on error" behavior.
+template <typename Container>
+bool read_whole_file(const std::string &filename, Container &container)
+{
+    auto fd = CoreFile::Private::try_open_fd(filename, O_RDONLY);
+    if(!fd.IsValid())
+        return false;
+
+    COREFILE_COUNT_SYSCALL();
+    struct stat st;
+    if(fstat(fd.Get(), &st) != 0 || !S_ISREG(st.st_mode))
+        return false;
+
+    auto done = CoreFile::Private::pread_whole(
+        fd.Get(),
+        static_cast<size_t>(st.st_size),
+        container,
+        filename
+    );
+    COREFILE_INSTRUMENT_BYTES(done);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Creates a new temporary file in the same directory of filename.
+// It must be in the same filesystem so it can be renamed over filename.
+CoreFile::Private::ScopedFd create_temp_file_for(
+    const std::string &filename,
+    std::string       &tempFilename)
+{
+    static std::atomic<unsigned> s_counter(0);
+
+    auto dirname  = CoreFile::Private::parent_directory(filename);
+    auto basename = filename.substr(filename.find_last_of('/') + 1);
+
+    while(true)
+    {
+        tempFilename = dirname + "/." + basename + ".tmp."
+                     + std::to_string(getpid()) + "."
+                     + std::to_string(s_counter++);
+
+        // The mode is filtered by the umask like any other new file.
+        auto fd = open(
+            tempFilename.c_str(),
+            O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+            0666
+        );
+        if(fd != -1)
+            return CoreFile::Private::ScopedFd(fd);
+
+        COREASSERT_THROW_IF_NOT(
+            errno == EEXIST || errno == EINTR,
+            std::ios::failure,
+            "Failed to create temporary file - filename: (%s) - error: (%s)",
+            tempFilename.c_str(),
+            strerror(errno)
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Common implementation of all WriteAll* functions.
+void write_file(
+    const std::string    &filename,
+    const void           *pData,
+    size_t                size,
+    CoreFile::WriteMode   mode,
+    CoreFile::Durability  durability)
+{
+    COREFILE_INSTRUMENT_BYTES(size);
+
+    //--------------------------------------------------------------------------
+    // In place.
+    if(mode == CoreFile::WriteMode::Truncate)
+    {
+        auto fd = CoreFile::Private::open_fd(filename, O_WRONLY | O_CREAT | O_TRUNC);
+        CoreFile::Private::write_all(fd.Get(), pData, size, filename);
+        CoreFile::Private::sync_file(fd.Get(), durability, filename);
+
+        if(durability == CoreFile::Durability::Full)
+            CoreFile::Private::fsync_parent_directory(filename);
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Atomic - Write temp + sync + rename.
+    std::string temp_filename;
+    auto fd = create_temp_file_for(filename, temp_filename);
+
+    try {
+        // Keep the permissions of the file being replaced.
+        struct stat st;
+        if(stat(filename.c_str(), &st) == 0)
+            fchmod(fd.Get(), st.st_mode & 07777);
+
+        CoreFile::Private::write_all(fd.Get(), pData, size, temp_filename);
+        CoreFile::Private::sync_file(fd.Get(), durability, temp_filename);
+        fd.Reset();
+
+        COREASSERT_THROW_IF_NOT(
+            rename(temp_filename.c_str(), filename.c_str()) == 0,
+            std::runtime_error,
+            "Failed to rename temporary file - src: (%s) - dst: (%s) - error: (%s)",
+            temp_filename.c_str(),
+            filename.c_str(),
+            strerror(errno)
+        );
+    } catch(...) {
+        unlink(temp_filename.c_str());
+        throw;
+    }
+
+    if(durability == CoreFile::Durability::Full)
+        CoreFile::Private::fsync_parent_directory(filename);
 }
 
 std::fstream::openmode filemode_to_openmode(const std::string &filemode)
@@ -102,6 +401,102 @@ std::fstream::openmode filemode_to_openmode(const std::string &filemode)
 }
 
 
+//----------------------------------------------------------------------------//
+// PosixBackend                                                               //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): The implementation of the whole file functions -
+//   The public ones only forward to the current backend.
+class PosixBackend :
+    public CoreFile::Backend
+{
+public:
+    bool ReadFile(const std::string &filename, std::string &contents) override
+    {
+        return read_whole_file(filename, contents);
+    }
+
+    bool ReadFile(
+        const std::string             &filename,
+        std::vector<CoreFile::byte_t> &contents) override
+    {
+        return read_whole_file(filename, contents);
+    }
+
+    void WriteFile(
+        const std::string    &filename,
+        const void           *pData,
+        size_t                size,
+        CoreFile::WriteMode   mode,
+        CoreFile::Durability  durability) override
+    {
+        write_file(filename, pData, size, mode, durability);
+    }
+
+    void AppendFile(
+        const std::string &filename,
+        const void        *pData,
+        size_t             size) override
+    {
+        // COWNOTE(n2omatt): O_APPEND + a single write(2) - The contents are
+        //   never interleaved with other appenders of the same file.
+        auto fd = CoreFile::Private::open_fd(filename, O_WRONLY | O_CREAT | O_APPEND);
+        CoreFile::Private::write_all(fd.Get(), pData, size, filename);
+    }
+
+    bool DeleteFile(const std::string &filename) override
+    {
+        COREFILE_COUNT_SYSCALL();
+        return remove(filename.c_str()) == 0;
+    }
+
+    bool IsFile(const std::string &filename) override
+    {
+        return CoreFS::IsFile(filename);
+    }
+
+    size_t GetFileSize(const std::string &filename) override
+    {
+        //COWTODO(n2omatt): How we gonna handle errors???
+        struct stat st;
+        if(stat(filename.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+            return 0;
+
+        return static_cast<size_t>(st.st_size);
+    }
+
+    void CopyFile(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite) override
+    {
+        copy_file(src, dst, overwrite, false);
+    }
+
+    void MoveFile(
+        const std::string &src,
+        const std::string &dst,
+        bool               overwrite) override
+    {
+        move_file(src, dst, overwrite);
+    }
+
+    void ReplaceFile(
+        const std::string &src,
+        const std::string &dst,
+        const std::string &backup) override
+    {
+        replace_file(src, dst, backup);
+    }
+};
+
+//------------------------------------------------------------------------------
+CoreFile::Backend& CoreFile::GetPosixBackend()
+{
+    static PosixBackend s_backend;
+    return s_backend;
+}
+
+
 //----------------------------------------------------------------------------//
 // Append                                                                     //
 //----------------------------------------------------------------------------//
@@ -110,18 +505,10 @@ void CoreFile::AppendAllLines(
     const std::string              &filename,
     const std::vector<std::string> &lines)
 {
-    std::stringstream ss;
-    std::string new_line = CoreFS::NewLine();
+    COREFILE_INSTRUMENT(IoOperation::Append);
 
-    //--------------------------------------------------------------------------
-    // Join the lines into a single string.
-    std::copy(
-        lines.begin(),
-        lines.end(),
-        std::ostream_iterator<std::string>(ss, new_line.c_str())
-    );
-
-    CoreFile::AppendAllText(filename, ss.str());
+    // Join the lines into a single buffer so they're appended at once.
+    CoreFile::AppendAllText(filename, Private::join_lines(lines));
 }
 
 //------------------------------------------------------------------------------
@@ -129,8 +516,10 @@ void CoreFile::AppendAllText(
     const std::string &filename,
     const std::string &contents)
 {
-    auto p_file_stream = CoreFile::Open(filename, FileMode::Text::kAppend);
-    (*p_file_stream) << contents;
+    COREFILE_INSTRUMENT(IoOperation::Append);
+    COREFILE_INSTRUMENT_BYTES(contents.size());
+
+    GetCurrentBackend().AppendFile(filename, contents.data(), contents.size());
 }
 
 
@@ -143,26 +532,8 @@ void CoreFile::Copy(
     const std::string &dst,
     bool               overwrite /* = false */)
 {
-    COREFILE_CHECK(
-        CoreFS::Exists(src),   // What is to check...
-        { return; },           // If check doesn't pass execute this block,
-        std::invalid_argument, // OR throw this exception...
-        "Source file doesn't exists - src: (%s)",
-        src.c_str()
-    );
-
-    COREFILE_CHECK(
-        (CoreFS::Exists(dst) && !overwrite),  // What is to check...
-        { return; },                          // If check doesn't pass execute this block,
-        std::runtime_error,                   // OR throw this exception...
-        "Destination file exists and overwrite is false - dst: (%s)",
-        dst.c_str()
-    );
-
-    CoreFile::WriteAllBytes(
-        dst,
-        CoreFile::ReadAllBytes(src)
-    );
+    COREFILE_INSTRUMENT(IoOperation::Copy);
+    GetCurrentBackend().CopyFile(src, dst, overwrite);
 }
 
 
@@ -188,13 +559,12 @@ std::unique_ptr<std::fstream> CoreFile::CreateText(const std::string &filename)
 //------------------------------------------------------------------------------
 void CoreFile::Delete(const std::string &filename)
 {
-    COREFILE_CHECK(
-        (remove(filename.c_str()) == 0), // What is to check...
-        { return; },                     // If check doesn't pass execute this block,
-        std::runtime_error,              // OR throw this exception...
-        "Failed to Delete file - filename (%s)",
-        filename.c_str()
-    );
+    COREFILE_INSTRUMENT(IoOperation::Delete);
+
+    // COWNOTE(n2omatt): This used to be inside a COREFILE_CHECK, which
+    //   expands to nothing, so the file was never removed. A file that
+    //   doesn't exist still isn't an error (like C#'s File.Delete).
+    GetCurrentBackend().DeleteFile(filename);
 }
 
 
@@ -204,7 +574,7 @@ void CoreFile::Delete(const std::string &filename)
 //------------------------------------------------------------------------------
 bool CoreFile::Exist(const std::string &filename)
 {
-    return CoreFS::IsFile(filename);
+    return GetCurrentBackend().IsFile(filename);
 }
 
 
@@ -261,15 +631,8 @@ void CoreFile::Move(
     const std::string &dst,
     bool               overwrite /* = false */)
 {
-    COREFILE_CHECK(
-        (rename(src.c_str(), dst.c_str()) == 0), // What is to check...
-        { return; },                             // If check doesn't pass execute this block,
-        std::runtime_error,                      // OR throw this exception...
-        "Failed to Move file - src (%s) dst (%s)",
-        src.c_str(),
-        dst.c_str()
-    );
-
+    COREFILE_INSTRUMENT(IoOperation::Move);
+    GetCurrentBackend().MoveFile(src, dst, overwrite);
 }
 
 
@@ -281,10 +644,12 @@ std::unique_ptr<std::fstream> CoreFile::Open(
     const std::string &filename,
     const std::string &filemode)
 {
+    COREFILE_INSTRUMENT(IoOperation::Open);
     auto openmode = filemode_to_openmode(filemode);
 
     auto p_stream = std::unique_ptr<std::fstream>(new std::fstream());
     //COWTODO(n2omatt): Check if could alloc the p_stream.
+    COREFILE_COUNT_SYSCALL();
     p_stream->open(filename.c_str(), openmode);
 
     COREASSERT_THROW_IF_NOT(
@@ -323,19 +688,11 @@ std::unique_ptr<std::fstream>  CoreFile::OpenWrite(const std::string &filename)
 //------------------------------------------------------------------------------
 std::vector<CoreFile::byte_t> CoreFile::ReadAllBytes(const std::string &filename)
 {
+    COREFILE_INSTRUMENT(IoOperation::ReadAll);
+
     //COWTODO(n2omatt): How we gonna handle errors??
     std::vector<CoreFile::byte_t> ret_val;
-
-    if(!CoreFile::Exist(filename))
-        return ret_val;
-
-    // Open the file and calculate it's size.
-    auto p_file_stream = CoreFile::OpenRead(filename);
-    auto size          = CoreFile::GetSize(*p_file_stream);
-
-    // Play nice with memory.
-    ret_val.resize(size);
-    p_file_stream->read((char *)(&ret_val[0]), size);
+    GetCurrentBackend().ReadFile(filename, ret_val);
 
     return ret_val;
 }
@@ -343,84 +700,105 @@ std::vector<CoreFile::byte_t> CoreFile::ReadAllBytes(const std::string &filename
 //------------------------------------------------------------------------------
 std::vector<std::string> CoreFile::ReadAllLines(const std::string &filename)
 {
+    COREFILE_INSTRUMENT(IoOperation::ReadAll);
+
     // COWTODO(n2omatt): How we gonna handle errors??
     std::vector<std::string> ret_val;
 
-    if(!CoreFile::Exist(filename))
+    std::string contents;
+    if(!GetCurrentBackend().ReadFile(filename, contents))
         return ret_val;
 
-    //Open the file and calculate it's size.
-    auto p_file_stream = CoreFile::OpenText(filename);
-    while(!p_file_stream->eof())
-    {
-        std::string line;
-        std::getline(*p_file_stream, line);
-        ret_val.push_back(line);
-    }
-
-    return ret_val;
+    return Private::split_lines(contents);
 }
 
 //------------------------------------------------------------------------------
 std::string CoreFile::ReadAllText(const std::string &filename)
 {
+    COREFILE_INSTRUMENT(IoOperation::ReadAll);
+
     // COWTODO(n2omatt): How we gonna handle errors??
     std::string ret_val;
-
-    if(!CoreFile::Exist(filename))
-        return ret_val;
-
-    auto bytes = CoreFile::ReadAllBytes(filename);
-    std::copy(
-        bytes.begin(),
-        bytes.end  (),
-        std::back_inserter(ret_val)
-    );
+    GetCurrentBackend().ReadFile(filename, ret_val);
 
     return ret_val;
 }
 
 
 
-//COWTODO(n2omatt): Check how to implement that....
-//Replace(const std::string &filename, const std::string &filename, const std::string &filename, Boolean) ???
+//----------------------------------------------------------------------------//
+// Replace                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void CoreFile::Replace(
+    const std::string &src,
+    const std::string &dst,
+    const std::string &backup /* = "" */)
+{
+    auto &backend = GetCurrentBackend();
+    COREASSERT_THROW_IF_NOT(
+        backend.IsFile(src) && backend.IsFile(dst),
+        std::runtime_error,
+        "Replace needs both files - src: (%s) - dst: (%s)",
+        src.c_str(),
+        dst.c_str()
+    );
+
+    backend.ReplaceFile(src, dst, backup);
+}
 
 
 //----------------------------------------------------------------------------//
 // Set * Time                                                                 //
 //----------------------------------------------------------------------------//
-void CoreFile::SetCreationTime(const std::string &filename, time_t dateTime)
+//------------------------------------------------------------------------------
+void CoreFile::SetCreationTime(
+    const std::string &filename,
+    time_t             /* dateTime */)
 {
-    //COWTODO(n2omatt): Implement...
-    //http://rosettacode.org/wiki/File_modification_time#C.2B.2B
-    //utimensat
+    // COWNOTE(n2omatt): Neither the status change time (the one that
+    //   GetCreationTime returns) nor the birth time can be set on Linux.
+    COREASSERT_THROW_IF_NOT(
+        false,
+        std::runtime_error,
+        "Failed to set creation time - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(ENOTSUP)
+    );
 }
 
+//------------------------------------------------------------------------------
 void CoreFile::SetCreationTimeUtc(const std::string &filename, time_t dateTime)
 {
-    //COWTODO(n2omatt): Implement...
+    SetCreationTime(filename, dateTime);
 }
 
 
+//------------------------------------------------------------------------------
 void CoreFile::SetLastAccessTime(const std::string &filename, time_t dateTime)
 {
-    //COWTODO(n2omatt): Implement...
+    SetLastAccessTimeNs(filename, FileTime(std::chrono::seconds(dateTime)));
 }
 
+//------------------------------------------------------------------------------
 void CoreFile::SetLastAccessTimeUtc(const std::string &filename, time_t dateTime)
 {
-    //COWTODO(n2omatt): Implement...
+    // time_t is always since the epoch (UTC) - Same of the local one.
+    SetLastAccessTime(filename, dateTime);
 }
 
 
+//------------------------------------------------------------------------------
 void CoreFile::SetLastWriteTime(const std::string &filename, time_t dateTime)
 {
-    //COWTODO(n2omatt): Implement...
+    SetLastWriteTimeNs(filename, FileTime(std::chrono::seconds(dateTime)));
 }
 
+//------------------------------------------------------------------------------
 void CoreFile::SetLastWriteTimeUtc(const std::string &filename, time_t dateTime)
 {
-    //COWTODO(n2omatt): Implement...
+    // time_t is always since the epoch (UTC) - Same of the local one.
+    SetLastWriteTime(filename, dateTime);
 }
 
 
@@ -430,12 +808,7 @@ void CoreFile::SetLastWriteTimeUtc(const std::string &filename, time_t dateTime)
 //------------------------------------------------------------------------------
 size_t CoreFile::GetSize(const std::string &filename)
 {
-    //COWTODO(n2omatt): How we gonna handle errors???
-    if(!CoreFile::Exist(filename))
-        return 0;
-
-    auto p_stream = OpenRead(filename);
-    return GetSize(*p_stream);
+    return GetCurrentBackend().GetFileSize(filename);
 }
 
 //------------------------------------------------------------------------------
@@ -443,15 +816,12 @@ size_t CoreFile::GetSize(std::fstream &fileStream)
 {
     auto curr = fileStream.tellg();
 
-    fileStream.seekg(0, std::ios::beg);
-    auto beg = fileStream.tellg();
-
     fileStream.seekg(0, std::ios::end);
     auto end = fileStream.tellg();
 
     fileStream.seekg(curr, std::ios::beg);
 
-    auto size = static_cast<size_t>(end - beg);
+    auto size = static_cast<size_t>(end);
     return size;
 }
 
@@ -462,55 +832,65 @@ size_t CoreFile::GetSize(std::fstream &fileStream)
 //------------------------------------------------------------------------------
 void CoreFile::WriteAllBytes(
     const std::string         &filename,
-    const std::vector<byte_t> &bytes)
+    const std::vector<byte_t> &bytes,
+    WriteMode                  mode       /* = WriteMode::Truncate */,
+    Durability                 durability /* = Durability::None  */)
 {
-    //COWTODO(n2omatt): How we gonna handle errors??
-    auto p_file_stream = CoreFile::Open(
-        filename,
-        FileMode::Binary::kReadWrite_Truncate
-    );
-    std::copy(
-        bytes.begin(),
-        bytes.end  (),
-        std::ostream_iterator<CoreFile::byte_t>(*p_file_stream)
-    );
+    COREFILE_INSTRUMENT(IoOperation::WriteAll);
+
+    GetCurrentBackend().WriteFile(filename, bytes.data(), bytes.size(), mode, durability);
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllBytes(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    WriteMode          mode       /* = WriteMode::Truncate */,
+    Durability         durability /* = Durability::None  */)
+{
+    COREFILE_INSTRUMENT(IoOperation::WriteAll);
+
+    // COWNOTE(n2omatt): The contents are sent straight to write(2)
+    //   instead of being inserted one byte at time into a std::fstream.
+    GetCurrentBackend().WriteFile(filename, pData, size, mode, durability);
 }
 
 //------------------------------------------------------------------------------
 void CoreFile::WriteAllLines(
     const std::string              &filename,
-    const std::vector<std::string> &lines)
+    const std::vector<std::string> &lines,
+    WriteMode                       mode       /* = WriteMode::Truncate */,
+    Durability                      durability /* = Durability::None  */)
 {
-    //COWTODO(n2omatt): How we gonna handle errors??
-    auto p_file_stream = CoreFile::Open(
-        filename,
-        FileMode::Text::kReadWrite_Truncate
-    );
+    COREFILE_INSTRUMENT(IoOperation::WriteAll);
 
-    std::copy(
-        lines.begin(),
-        lines.end  (),
-        std::ostream_iterator<std::string>(
-            *p_file_stream,
-            CoreFS::NewLine().c_str()
-        )
-    );
+    // Join the lines into a single buffer so it's written at once.
+    auto contents = Private::join_lines(lines);
+    GetCurrentBackend().WriteFile(filename, contents.data(), contents.size(), mode, durability);
 }
 
 //------------------------------------------------------------------------------
 void CoreFile::WriteAllText(
     const std::string &filename,
-    const std::string &contents)
+    const std::string &contents,
+    WriteMode          mode       /* = WriteMode::Truncate */,
+    Durability         durability /* = Durability::None  */)
 {
-    //COWTODO(n2omatt): How we gonna handle errors??
-    auto p_file_stream = CoreFile::Open(
-        filename,
-        FileMode::Text::kReadWrite_Truncate
-    );
+    COREFILE_INSTRUMENT(IoOperation::WriteAll);
 
-    std::copy(
-        contents.begin(),
-        contents.end  (),
-        std::ostream_iterator<char>(*p_file_stream)
-    );
+    GetCurrentBackend().WriteFile(filename, contents.data(), contents.size(), mode, durability);
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllText(
+    const std::string &filename,
+    const char        *pContents,
+    size_t             size,
+    WriteMode          mode       /* = WriteMode::Truncate */,
+    Durability         durability /* = Durability::None  */)
+{
+    COREFILE_INSTRUMENT(IoOperation::WriteAll);
+
+    GetCurrentBackend().WriteFile(filename, pContents, size, mode, durability);
 }
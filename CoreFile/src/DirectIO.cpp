@@ -0,0 +1,400 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DirectIO.cpp                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/DirectIO.h"
+// std
+#include <cstdlib>
+#include <new>
+// CoreFile
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static size_t align_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+//------------------------------------------------------------------------------
+// Opens the file with O_DIRECT, falling back to buffered I/O when it
+// fails - open(2) gives EINVAL when the filesystem doesn't support it.
+static Private::ScopedFd open_direct(
+    const std::string &filename,
+    int                flags,
+    bool              &isDirect)
+{
+#if defined(O_DIRECT)
+    int fd = -1;
+    do {
+        COREFILE_COUNT_SYSCALL();
+        fd = open(filename.c_str(), flags | O_DIRECT | O_CLOEXEC, 0666);
+    } while(fd == -1 && errno == EINTR);
+
+    isDirect = (fd != -1);
+    if(isDirect)
+        return Private::ScopedFd(fd);
+
+    // Falls back on every error, not only EINVAL - If the error is real
+    // (missing file, no permission...) open_fd fails the same way and
+    // reports it.
+#endif
+
+    isDirect = false;
+    return Private::open_fd(filename, flags);
+}
+
+//------------------------------------------------------------------------------
+// Drops the (clean) pages of the file from the page cache, so the
+// buffered fallback doesn't pollute it either.
+static void drop_from_page_cache(int fd)
+{
+#if defined(POSIX_FADV_DONTNEED)
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Reads the file from the start, one aligned buffer at time.
+// COWNOTE(n2omatt): Each buffer is filled by a single pread(2) because
+//   with O_DIRECT a read continuing at an unaligned offset fails with
+//   EINVAL - Short reads of regular files only happen at EOF anyway.
+template <typename Func>
+static void read_direct(
+    int                fd,
+    const std::string &filename,
+    AlignedBufferPool &pool,
+    Func               func)
+{
+    auto buffer = pool.Acquire();
+
+    uint64_t offset = 0;
+    while(true)
+    {
+        ssize_t result = -1;
+        do {
+            COREFILE_COUNT_SYSCALL();
+            result = pread(fd, buffer.Data(), buffer.Size(), offset);
+        } while(result == -1 && errno == EINTR);
+
+        COREASSERT_THROW_IF_NOT(
+            result != -1,
+            std::runtime_error,
+            "Failed to read file - filename: (%s) - error: (%s)",
+            filename.c_str(),
+            strerror(errno)
+        );
+
+        if(result == 0)
+            break;
+
+        func(offset, buffer.Data(), static_cast<size_t>(result));
+
+        offset += static_cast<uint64_t>(result);
+        if(static_cast<size_t>(result) < buffer.Size())
+            break;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// AlignedBuffer                                                              //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+AlignedBuffer::AlignedBuffer() :
+    // Members.
+    m_pPool(nullptr),
+    m_pData(nullptr),
+    m_size (0)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+AlignedBuffer::AlignedBuffer(
+    AlignedBufferPool *pPool,
+    byte_t            *pData,
+    size_t             size) :
+    // Members.
+    m_pPool(pPool),
+    m_pData(pData),
+    m_size (size)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+AlignedBuffer::~AlignedBuffer()
+{
+    Release();
+}
+
+//------------------------------------------------------------------------------
+AlignedBuffer::AlignedBuffer(AlignedBuffer &&other) :
+    // Members.
+    m_pPool(other.m_pPool),
+    m_pData(other.m_pData),
+    m_size (other.m_size )
+{
+    other.m_pPool = nullptr;
+    other.m_pData = nullptr;
+    other.m_size  = 0;
+}
+
+//------------------------------------------------------------------------------
+AlignedBuffer& AlignedBuffer::operator =(AlignedBuffer &&other)
+{
+    if(this != &other)
+    {
+        Release();
+
+        m_pPool = other.m_pPool;
+        m_pData = other.m_pData;
+        m_size  = other.m_size;
+
+        other.m_pPool = nullptr;
+        other.m_pData = nullptr;
+        other.m_size  = 0;
+    }
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+void AlignedBuffer::Release()
+{
+    if(m_pPool && m_pData)
+        m_pPool->Give(m_pData);
+
+    m_pPool = nullptr;
+    m_pData = nullptr;
+    m_size  = 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// AlignedBufferPool                                                          //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+AlignedBufferPool::AlignedBufferPool(
+    size_t bufferSize,
+    size_t alignment,
+    size_t maxCached) :
+    // Members.
+    m_bufferSize(0),
+    m_alignment (alignment),
+    m_maxCached (maxCached)
+{
+    COREASSERT_THROW_IF_NOT(
+        alignment >= sizeof(void *) && (alignment & (alignment - 1)) == 0,
+        std::invalid_argument,
+        "Alignment must be a power of two - alignment: (%zu)",
+        alignment
+    );
+    COREASSERT_THROW_IF_NOT(
+        bufferSize != 0,
+        std::invalid_argument,
+        "Invalid buffer size - bufferSize: (%zu)",
+        bufferSize
+    );
+
+    m_bufferSize = align_up(bufferSize, alignment);
+}
+
+//------------------------------------------------------------------------------
+AlignedBufferPool::~AlignedBufferPool()
+{
+    for(auto p_data : m_free)
+        free(p_data);
+}
+
+//------------------------------------------------------------------------------
+AlignedBufferPool& AlignedBufferPool::GetDefault()
+{
+    static AlignedBufferPool s_pool;
+    return s_pool;
+}
+
+//------------------------------------------------------------------------------
+AlignedBuffer AlignedBufferPool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_free.empty())
+        {
+            auto p_data = m_free.back();
+            m_free.pop_back();
+
+            return AlignedBuffer(this, p_data, m_bufferSize);
+        }
+    }
+
+    void *p_data = nullptr;
+    if(posix_memalign(&p_data, m_alignment, m_bufferSize) != 0)
+        throw std::bad_alloc();
+
+    return AlignedBuffer(this, static_cast<byte_t *>(p_data), m_bufferSize);
+}
+
+//------------------------------------------------------------------------------
+void AlignedBufferPool::Give(byte_t *pData)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_free.size() < m_maxCached)
+        {
+            m_free.push_back(pData);
+            return;
+        }
+    }
+
+    free(pData);
+}
+
+
+//----------------------------------------------------------------------------//
+// Direct I/O                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<byte_t> CoreFile::ReadAllBytesDirect(
+    const std::string &filename,
+    AlignedBufferPool &pool)
+{
+    auto is_direct = false;
+    auto fd        = open_direct(filename, O_RDONLY, is_direct);
+
+    // COWNOTE(n2omatt): The vector memory isn't aligned so the data has
+    //   to pass through the pool buffer - The copy is still way cheaper
+    //   than the device transfer.
+    std::vector<byte_t> bytes;
+    bytes.reserve(Private::fd_size(fd.Get(), filename));
+
+    read_direct(fd.Get(), filename, pool,
+        [&bytes](uint64_t, const byte_t *pData, size_t size) {
+            bytes.insert(bytes.end(), pData, pData + size);
+        }
+    );
+
+    if(!is_direct)
+        drop_from_page_cache(fd.Get());
+
+    return bytes;
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::ReadDirect(
+    const std::string   &filename,
+    const ChunkCallback &callback,
+    AlignedBufferPool   &pool)
+{
+    auto is_direct = false;
+    auto fd        = open_direct(filename, O_RDONLY, is_direct);
+
+    read_direct(fd.Get(), filename, pool, callback);
+
+    if(!is_direct)
+        drop_from_page_cache(fd.Get());
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllBytesDirect(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    AlignedBufferPool &pool)
+{
+    auto is_direct = false;
+    auto fd        = open_direct(
+        filename,
+        O_WRONLY | O_CREAT | O_TRUNC,
+        is_direct
+    );
+
+    //--------------------------------------------------------------------------
+    // Buffered fallback - The data must be on disk before the pages can
+    // be dropped from the cache.
+    if(!is_direct)
+    {
+        Private::write_all(fd.Get(), pData, size, filename);
+        fdatasync(fd.Get());
+        drop_from_page_cache(fd.Get());
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Direct I/O.
+    auto buffer  = pool.Acquire();
+    auto p_bytes = static_cast<const byte_t *>(pData);
+    auto padded  = false;
+
+    size_t written = 0;
+    while(written < size)
+    {
+        auto chunk_size    = std::min(size - written, buffer.Size());
+        auto transfer_size = align_up(chunk_size, pool.GetAlignment());
+
+        std::memcpy(buffer.Data(), p_bytes + written, chunk_size);
+        if(transfer_size != chunk_size)
+        {
+            std::memset(
+                buffer.Data() + chunk_size,
+                0,
+                transfer_size - chunk_size
+            );
+            padded = true;
+        }
+
+        Private::write_all(fd.Get(), buffer.Data(), transfer_size, filename);
+        written += chunk_size;
+    }
+
+    // Cut the zero padding of the tail.
+    if(padded)
+    {
+        COREASSERT_THROW_IF_NOT(
+            ftruncate(fd.Get(), static_cast<off_t>(size)) == 0,
+            std::runtime_error,
+            "Failed to truncate file - filename: (%s) - error: (%s)",
+            filename.c_str(),
+            strerror(errno)
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::WriteAllBytesDirect(
+    const std::string         &filename,
+    const std::vector<byte_t> &bytes,
+    AlignedBufferPool         &pool)
+{
+    WriteAllBytesDirect(filename, bytes.data(), bytes.size(), pool);
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::DropFromPageCache(const std::string &filename)
+{
+    auto fd = Private::open_fd(filename, O_RDONLY);
+    drop_from_page_cache(fd.Get());
+}
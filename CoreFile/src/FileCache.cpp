@@ -0,0 +1,340 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileCache.cpp                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/FileCache.h"
+// std
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+// CoreFile
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+namespace {
+
+// What identifies a version of the file.
+struct FileKey
+{
+    dev_t    dev;
+    ino_t    ino;
+    off_t    size;
+    time_t   mtimeSec;
+    long     mtimeNsec;
+
+    bool operator ==(const FileKey &other) const
+    {
+        return dev       == other.dev
+            && ino       == other.ino
+            && size      == other.size
+            && mtimeSec  == other.mtimeSec
+            && mtimeNsec == other.mtimeNsec;
+    }
+
+    bool operator !=(const FileKey &other) const { return !(*this == other); }
+};
+
+struct CacheEntry
+{
+    std::string        filename;
+    FileKey            key;
+    FileCache::Content content;
+    size_t             bytes;
+};
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static FileKey make_key(const struct stat &st)
+{
+    FileKey key;
+    key.dev       = st.st_dev;
+    key.ino       = st.st_ino;
+    key.size      = st.st_size;
+    key.mtimeSec  = st.st_mtim.tv_sec;
+    key.mtimeNsec = st.st_mtim.tv_nsec;
+
+    return key;
+}
+
+//------------------------------------------------------------------------------
+static const FileCache::Content& empty_content()
+{
+    static const FileCache::Content s_empty = std::make_shared<std::string>();
+    return s_empty;
+}
+
+//------------------------------------------------------------------------------
+// Reads the file and gets the key of the version that was read.
+// Returns false if the file doesn't exist or isn't a regular file.
+static bool read_file(
+    const std::string  &filename,
+    std::string        &contents,
+    FileKey            &key)
+{
+    auto fd = Private::try_open_fd(filename, O_RDONLY);
+    if(!fd.IsValid())
+        return false;
+
+    COREFILE_COUNT_SYSCALL();
+    struct stat st;
+    if(fstat(fd.Get(), &st) != 0 || !S_ISREG(st.st_mode))
+        return false;
+
+    // Same read of ReadAllText - Files that report size 0 (i.e. /proc)
+    // are read until EOF.
+    Private::pread_whole(fd.Get(), static_cast<size_t>(st.st_size), contents, filename);
+
+    key = make_key(st);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Shard                                                                      //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): The most recently used entries are at the front of
+//   the list - Evictions happen from the back.
+//   generation changes on every Invalidate / Clear, so a Get that read
+//   the file before one of them doesn't insert what it read.
+class CoreFile::Private::FileCacheShard
+{
+public:
+    typedef std::list<CacheEntry>::iterator iterator;
+
+public:
+    explicit FileCacheShard(size_t budget) :
+        // Members.
+        budget    (budget),
+        bytes     (0),
+        generation(0)
+    {
+        // Empty...
+    }
+
+public:
+    void Erase(iterator it)
+    {
+        bytes -= it->bytes;
+        index.erase(it->filename);
+        lru.erase(it);
+    }
+
+public:
+    std::mutex mutex;
+
+    std::list<CacheEntry>                     lru;
+    std::unordered_map<std::string, iterator> index;
+
+    size_t   budget;
+    size_t   bytes;
+    uint64_t generation;
+};
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileCache::FileCache(
+    size_t     byteBudget,
+    size_t     shardCount,
+    Validation validation) :
+    // Members.
+    m_byteBudget   (byteBudget),
+    m_validation   (validation),
+    m_hits         (0),
+    m_misses       (0),
+    m_evictions    (0),
+    m_invalidations(0)
+{
+    shardCount = std::max<size_t>(1, shardCount);
+
+    m_shards.reserve(shardCount);
+    for(size_t i = 0; i < shardCount; ++i)
+    {
+        m_shards.emplace_back(
+            new Private::FileCacheShard(byteBudget / shardCount)
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+FileCache::~FileCache()
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileCache::Content FileCache::Get(const std::string &filename)
+{
+    auto &shard = GetShard(filename);
+
+    //--------------------------------------------------------------------------
+    // Fast path - The cached version is still the current one.
+    auto validate = (m_validation == Validation::Stat);
+
+    struct stat st;
+    auto exists = !validate
+        || (stat(filename.c_str(), &st) == 0 && S_ISREG(st.st_mode));
+
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.index.find(filename);
+        if(it != shard.index.end())
+        {
+            if(!validate || (exists && it->second->key == make_key(st)))
+            {
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                ++m_hits;
+
+                return it->second->content;
+            }
+
+            shard.Erase(it->second);
+            ++m_invalidations;
+        }
+
+        generation = shard.generation;
+    }
+
+    ++m_misses;
+    if(!exists)
+        return empty_content();
+
+    //--------------------------------------------------------------------------
+    // Slow path - Read outside the lock, the key comes from the same
+    // descriptor so it always matches the contents.
+    std::string contents;
+    FileKey     key;
+    if(!read_file(filename, contents, key))
+        return empty_content();
+
+    auto content = std::make_shared<const std::string>(std::move(contents));
+    auto bytes   = content->size() + filename.size();
+    if(bytes > shard.budget)
+        return content;
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Invalidated while it was being read - What was read may be the old
+    // version, so the caller gets it but it isn't cached.
+    if(shard.generation != generation)
+        return content;
+
+    // Another thread may have read the file meanwhile.
+    auto it = shard.index.find(filename);
+    if(it != shard.index.end())
+        shard.Erase(it->second);
+
+    shard.lru.push_front(CacheEntry { filename, key, content, bytes });
+    shard.index[filename] = shard.lru.begin();
+    shard.bytes          += bytes;
+
+    while(shard.bytes > shard.budget)
+    {
+        shard.Erase(std::prev(shard.lru.end()));
+        ++m_evictions;
+    }
+
+    return content;
+}
+
+//------------------------------------------------------------------------------
+void FileCache::Invalidate(const std::string &filename)
+{
+    auto &shard = GetShard(filename);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    ++shard.generation;
+
+    auto it = shard.index.find(filename);
+    if(it != shard.index.end())
+    {
+        shard.Erase(it->second);
+        ++m_invalidations;
+    }
+}
+
+//------------------------------------------------------------------------------
+void FileCache::Clear()
+{
+    for(auto &p_shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(p_shard->mutex);
+
+        p_shard->lru  .clear();
+        p_shard->index.clear();
+        p_shard->bytes = 0;
+        ++p_shard->generation;
+    }
+}
+
+//------------------------------------------------------------------------------
+FileCache::Stats FileCache::GetStats() const
+{
+    Stats stats;
+    stats.hits          = m_hits;
+    stats.misses        = m_misses;
+    stats.evictions     = m_evictions;
+    stats.invalidations = m_invalidations;
+    stats.entries       = 0;
+    stats.bytes         = 0;
+
+    for(auto &p_shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(p_shard->mutex);
+
+        stats.entries += p_shard->lru.size();
+        stats.bytes   += p_shard->bytes;
+    }
+
+    return stats;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Private::FileCacheShard& FileCache::GetShard(const std::string &filename)
+{
+    auto hash = std::hash<std::string>()(filename);
+    return *m_shards[hash % m_shards.size()];
+}
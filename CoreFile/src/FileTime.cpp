@@ -0,0 +1,360 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileTime.cpp                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/FileTime.h"
+// std
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+// POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+// CoreFile
+#include "../include/Metadata.h"
+#include "private/Parallel_For.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Timezone transitions are months apart, so a window with the same
+// offset on both of its ends has that offset all along.
+constexpr int64_t kOffsetWindowSeconds = 15 * 60;
+// Windows cached per thread - Times of a directory tend to be close.
+constexpr size_t  kOffsetCacheSlots    = 64;
+
+constexpr int64_t kSecondsPerDay = 24 * 60 * 60;
+
+// Files touched by a thread at a time.
+constexpr size_t kSetTimesBlockSize = 64;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+// A window of time where the UTC offset of the local timezone is constant.
+struct OffsetWindow
+{
+    bool        valid;
+    unsigned    generation;
+    int64_t     window;
+    long        gmtoff;
+    int         isdst;
+    const char *pZone;
+};
+
+
+//----------------------------------------------------------------------------//
+// Variables                                                                  //
+//----------------------------------------------------------------------------//
+static std::atomic<unsigned> s_offsetGeneration(0);
+
+// COWNOTE(n2omatt): Per thread so the lookups never lock or share
+//   cache lines - Zero initialized, so every slot starts invalid.
+static thread_local OffsetWindow t_offsetCache[kOffsetCacheSlots];
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static int64_t floor_div(int64_t value, int64_t divisor)
+{
+    auto result = value / divisor;
+    if(value % divisor < 0)
+        --result;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+static bool is_leap_year(int64_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+//------------------------------------------------------------------------------
+// Breaks the seconds since the epoch down - Without any timezone.
+// COWNOTE(n2omatt): The days to civil date conversion is the one of
+//   Howard Hinnant's "chrono-Compatible Low-Level Date Algorithms".
+static tm_t break_down(int64_t time)
+{
+    static const int kDaysBeforeMonth[12] = {
+        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+    };
+
+    auto days    = floor_div(time, kSecondsPerDay);
+    auto seconds = time - days * kSecondsPerDay;
+
+    // Shift the epoch to 0000-03-01, so the leap day is the last one.
+    auto z   = days + 719468;
+    auto era = floor_div(z, 146097);
+    auto doe = z - era * 146097;                                     // [0, 146096]
+    auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+    auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);               // [0, 365]
+    auto mp  = (5 * doy + 2) / 153;                                   // [0, 11]
+
+    auto weekday = (days + 4) % 7; // 1970-01-01 was a Thursday.
+    if(weekday < 0)
+        weekday += 7;
+
+    auto day   = doy - (153 * mp + 2) / 5 + 1;
+    auto month = (mp < 10) ? mp + 3 : mp - 9;
+    auto year  = yoe + era * 400 + ((month <= 2) ? 1 : 0);
+
+    tm_t result;
+    std::memset(&result, 0, sizeof(result));
+
+    result.tm_sec  = static_cast<int>(seconds % 60);
+    result.tm_min  = static_cast<int>(seconds / 60 % 60);
+    result.tm_hour = static_cast<int>(seconds / 3600);
+    result.tm_mday = static_cast<int>(day);
+    result.tm_mon  = static_cast<int>(month - 1);
+    result.tm_year = static_cast<int>(year - 1900);
+    result.tm_wday = static_cast<int>(weekday);
+    result.tm_yday = kDaysBeforeMonth[month - 1] + static_cast<int>(day - 1)
+                   + ((month > 2 && is_leap_year(year)) ? 1 : 0);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Finds the UTC offset window of the time - Returns nullptr if the
+// offset changes inside of the window, so it can't be cached.
+static const OffsetWindow* find_offset_window(time_t time)
+{
+    auto window     = floor_div(time, kOffsetWindowSeconds);
+    auto generation = s_offsetGeneration.load(std::memory_order_relaxed);
+
+    auto &slot = t_offsetCache[static_cast<uint64_t>(window) % kOffsetCacheSlots];
+    if(slot.valid && slot.window == window && slot.generation == generation)
+        return &slot;
+
+    // Miss - The offset must be the same on both ends of the window.
+    time_t first = static_cast<time_t>(window * kOffsetWindowSeconds);
+    time_t last  = static_cast<time_t>(first + kOffsetWindowSeconds - 1);
+
+    tm_t first_tm, last_tm;
+    if(!localtime_r(&first, &first_tm) || !localtime_r(&last, &last_tm))
+        return nullptr;
+
+    if(first_tm.tm_gmtoff != last_tm.tm_gmtoff ||
+       first_tm.tm_isdst  != last_tm.tm_isdst)
+    {
+        return nullptr;
+    }
+
+    slot.valid      = true;
+    slot.generation = generation;
+    slot.window     = window;
+    slot.gmtoff     = first_tm.tm_gmtoff;
+    slot.isdst      = first_tm.tm_isdst;
+    slot.pZone      = first_tm.tm_zone;
+
+    return &slot;
+}
+
+//------------------------------------------------------------------------------
+// Sets the times (nullptr keeps the time) - Returns 0 or the errno.
+static int set_times(
+    const char      *pFilename,
+    const FileTime  *pAccessTime,
+    const FileTime  *pWriteTime,
+    bool             followSymlinks)
+{
+    struct timespec times[2];
+    times[0].tv_sec = 0;
+    times[1].tv_sec = 0;
+
+    if(pAccessTime) times[0] = ToTimespec(*pAccessTime);
+    else            times[0].tv_nsec = UTIME_OMIT;
+
+    if(pWriteTime) times[1] = ToTimespec(*pWriteTime);
+    else           times[1].tv_nsec = UTIME_OMIT;
+
+    auto flags = (followSymlinks) ? 0 : AT_SYMLINK_NOFOLLOW;
+    if(utimensat(AT_FDCWD, pFilename, times, flags) != 0)
+        return errno;
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+static void set_times_or_throw(
+    const std::string &filename,
+    const FileTime    *pAccessTime,
+    const FileTime    *pWriteTime)
+{
+    auto error = set_times(filename.c_str(), pAccessTime, pWriteTime, true);
+    COREASSERT_THROW_IF_NOT(
+        error == 0,
+        std::runtime_error,
+        "Failed to set file times - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(error)
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// Conversions                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileTime CoreFile::ToFileTime(const struct timespec &time)
+{
+    auto duration = std::chrono::seconds    (time.tv_sec )
+                  + std::chrono::nanoseconds(time.tv_nsec);
+
+    return FileTime(duration);
+}
+
+//------------------------------------------------------------------------------
+struct timespec CoreFile::ToTimespec(FileTime time)
+{
+    auto ns      = time.time_since_epoch().count();
+    auto seconds = floor_div(ns, 1000000000);
+
+    struct timespec result;
+    result.tv_sec  = static_cast<time_t>(seconds);
+    result.tv_nsec = static_cast<long  >(ns - seconds * 1000000000);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+CoreFile::tm_t CoreFile::ToLocalTime(time_t time)
+{
+    auto p_window = find_offset_window(time);
+    if(!p_window)
+    {
+        // Around a transition (rare) - Let the libc figure it out.
+        tm_t result;
+        if(!localtime_r(&time, &result))
+            return ToUtcTime(time);
+
+        return result;
+    }
+
+    auto result = break_down(static_cast<int64_t>(time) + p_window->gmtoff);
+    result.tm_isdst  = p_window->isdst;
+    result.tm_gmtoff = p_window->gmtoff;
+    result.tm_zone   = p_window->pZone;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+CoreFile::tm_t CoreFile::ToUtcTime(time_t time)
+{
+    auto result = break_down(static_cast<int64_t>(time));
+    result.tm_zone = "GMT"; // Same of gmtime(3).
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::ResetTimeZoneCache()
+{
+    s_offsetGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+//----------------------------------------------------------------------------//
+// Get * Time                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileTime CoreFile::GetCreationTimeNs(const std::string &filename)
+{
+    return ToFileTime(GetMetadata(filename).changeTime);
+}
+
+//------------------------------------------------------------------------------
+FileTime CoreFile::GetLastAccessTimeNs(const std::string &filename)
+{
+    return ToFileTime(GetMetadata(filename).accessTime);
+}
+
+//------------------------------------------------------------------------------
+FileTime CoreFile::GetLastWriteTimeNs(const std::string &filename)
+{
+    return ToFileTime(GetMetadata(filename).modifyTime);
+}
+
+
+//----------------------------------------------------------------------------//
+// Set * Time                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void CoreFile::SetLastAccessTimeNs(const std::string &filename, FileTime time)
+{
+    set_times_or_throw(filename, &time, nullptr);
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::SetLastWriteTimeNs(const std::string &filename, FileTime time)
+{
+    set_times_or_throw(filename, nullptr, &time);
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::SetFileTimes(
+    const std::string &filename,
+    FileTime           accessTime,
+    FileTime           writeTime)
+{
+    set_times_or_throw(filename, &accessTime, &writeTime);
+}
+
+//------------------------------------------------------------------------------
+std::vector<int> CoreFile::SetFileTimes(
+    const std::vector<FileTimeUpdate> &updates,
+    size_t                             threads,
+    bool                               followSymlinks)
+{
+    std::vector<int> result(updates.size(), 0);
+
+    Private::parallel_for(
+        updates.size(),
+        threads,
+        kSetTimesBlockSize,
+        [&](size_t i) {
+            auto &update = updates[i];
+            if(!update.setAccessTime && !update.setWriteTime)
+                return;
+
+            result[i] = set_times(
+                update.filename.c_str(),
+                (update.setAccessTime) ? &update.accessTime : nullptr,
+                (update.setWriteTime ) ? &update.writeTime  : nullptr,
+                followSymlinks
+            );
+        }
+    );
+
+    return result;
+}
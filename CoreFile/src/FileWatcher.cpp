@@ -0,0 +1,447 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileWatcher.cpp                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/FileWatcher.h"
+// std
+#include <utility>
+#include <vector>
+// POSIX
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+// CoreFile
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr std::chrono::milliseconds FileWatcher::kDefaultDebounce;
+constexpr std::chrono::milliseconds FileWatcher::kRearmInterval;
+
+// Everything that can change what is at the path of a watched file.
+constexpr uint32_t kDirectoryMask =
+      IN_MODIFY     | IN_CLOSE_WRITE | IN_ATTRIB
+    | IN_CREATE     | IN_MOVED_TO
+    | IN_DELETE     | IN_MOVED_FROM
+    | IN_DELETE_SELF| IN_MOVE_SELF
+    | IN_ONLYDIR;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static std::string base_name(const std::string &filename)
+{
+    auto index = filename.find_last_of('/');
+    if(index == std::string::npos)
+        return filename;
+
+    return filename.substr(index + 1);
+}
+
+//------------------------------------------------------------------------------
+// Converts the inotify(7) mask of an entry of the directory.
+static FileWatcher::Event mask_to_event(uint32_t mask)
+{
+    if(mask & IN_DELETE    ) return FileWatcher::Event::Deleted;
+    if(mask & IN_MOVED_FROM) return FileWatcher::Event::Moved;
+    if(mask & (IN_CREATE | IN_MOVED_TO)) return FileWatcher::Event::Created;
+
+    return FileWatcher::Event::Modified;
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileWatcher::FileWatcher(
+    Callback                  callback,
+    std::chrono::milliseconds debounce) :
+    // Members.
+    m_callback(std::move(callback)),
+    m_debounce(debounce),
+    m_fd      (inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+    m_stopFd  (-1)
+{
+    COREASSERT_THROW_IF_NOT(
+        m_fd != -1,
+        std::runtime_error,
+        "Failed to create inotify instance - error: (%s)",
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+FileWatcher::~FileWatcher()
+{
+    Stop();
+
+    // Closing the descriptor removes all the watches.
+    close(m_fd);
+}
+
+
+//----------------------------------------------------------------------------//
+// Watches                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void FileWatcher::Watch(const std::string &filename)
+{
+    auto dirname = Private::parent_directory(filename);
+    auto name    = base_name(filename);
+
+    // COWNOTE(n2omatt): inotify_add_watch(2) gives the same descriptor
+    //   for every path of the same directory ("dir", "dir/", "./dir"...)
+    //   so they all end up in the same DirectoryWatch.
+    auto wd = inotify_add_watch(m_fd, dirname.c_str(), kDirectoryMask);
+    COREASSERT_THROW_IF_NOT(
+        wd != -1,
+        std::runtime_error,
+        "Failed to watch file - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(errno)
+    );
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto &watch = m_watches[wd];
+    if(watch.dirname.empty())
+        watch.dirname = dirname;
+
+    watch.files[name] = filename;
+}
+
+//------------------------------------------------------------------------------
+void FileWatcher::Unwatch(const std::string &filename)
+{
+    auto name = base_name(filename);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending.erase(filename);
+
+    for(auto it = m_watches.begin(); it != m_watches.end(); ++it)
+    {
+        auto &files = it->second.files;
+
+        auto file_it = files.find(name);
+        if(file_it == files.end() || file_it->second != filename)
+            continue;
+
+        files.erase(file_it);
+        if(files.empty())
+        {
+            inotify_rm_watch(m_fd, it->first);
+            m_watches.erase(it);
+        }
+        return;
+    }
+
+    // Or the directory was removed and it's waiting to be re-armed.
+    for(auto it = m_lostWatches.begin(); it != m_lostWatches.end(); ++it)
+    {
+        auto &files = it->files;
+
+        auto file_it = files.find(name);
+        if(file_it == files.end() || file_it->second != filename)
+            continue;
+
+        files.erase(file_it);
+        if(files.empty())
+            m_lostWatches.erase(it);
+        return;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Background Thread                                                          //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void FileWatcher::Start()
+{
+    if(m_thread.joinable())
+        return;
+
+    m_stopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    COREASSERT_THROW_IF_NOT(
+        m_stopFd != -1,
+        std::runtime_error,
+        "Failed to create eventfd - error: (%s)",
+        strerror(errno)
+    );
+
+    m_thread = std::thread(&FileWatcher::ThreadLoop, this);
+}
+
+//------------------------------------------------------------------------------
+void FileWatcher::Stop()
+{
+    if(!m_thread.joinable())
+        return;
+
+    uint64_t value = 1;
+    while(write(m_stopFd, &value, sizeof(value)) == -1 && errno == EINTR)
+    {
+        // Empty...
+    }
+
+    m_thread.join();
+
+    close(m_stopFd);
+    m_stopFd = -1;
+}
+
+
+//----------------------------------------------------------------------------//
+// Event Loop Integration                                                     //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int FileWatcher::Process()
+{
+    ReadEvents();
+
+    // Take the due events and call the callbacks outside of the lock,
+    // so they can Watch / Unwatch.
+    std::vector<std::pair<std::string, Event>> due;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        RearmWatches();
+
+        auto now = Clock::now();
+        for(auto it = m_pending.begin(); it != m_pending.end(); /* Empty */)
+        {
+            if(it->second.deadline > now)
+            {
+                ++it;
+                continue;
+            }
+
+            due.emplace_back(it->first, it->second.event);
+            it = m_pending.erase(it);
+        }
+    }
+
+    for(auto &pair : due)
+        m_callback(pair.first, pair.second);
+
+    return static_cast<int>(due.size());
+}
+
+//------------------------------------------------------------------------------
+int FileWatcher::GetTimeout() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_pending.empty() && m_lostWatches.empty())
+        return -1;
+
+    auto now  = Clock::now();
+    auto next = now + kRearmInterval;
+    if(m_lostWatches.empty())
+        next = m_pending.begin()->second.deadline;
+
+    for(auto &pair : m_pending)
+        next = std::min(next, pair.second.deadline);
+
+    if(next <= now)
+        return 0;
+
+    // Round up, so the caller doesn't wake up right before it's due.
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        next - now + std::chrono::microseconds(999)
+    );
+
+    return static_cast<int>(ms.count());
+}
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileWatcher::Callback FileWatcher::InvalidateCache(FileCache &cache)
+{
+    return [&cache](const std::string &filename, Event) {
+        cache.Invalidate(filename);
+    };
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void FileWatcher::ReadEvents()
+{
+    alignas(struct inotify_event) char buffer[64 * 1024];
+
+    while(true)
+    {
+        auto size = read(m_fd, buffer, sizeof(buffer));
+        if(size == -1 && errno == EINTR)
+            continue;
+        if(size <= 0)
+            return; // EAGAIN - Nothing else to read.
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(auto p_curr = buffer; p_curr < buffer + size; /* Empty */)
+        {
+            auto p_event = reinterpret_cast<const struct inotify_event *>(p_curr);
+            p_curr += sizeof(struct inotify_event) + p_event->len;
+
+            // Events were lost - Anything may have changed.
+            if(p_event->mask & IN_Q_OVERFLOW)
+            {
+                for(auto &watch : m_watches)
+                    for(auto &file : watch.second.files)
+                        AddPending(file.second, Event::Modified);
+                continue;
+            }
+
+            auto it = m_watches.find(p_event->wd);
+            if(it == m_watches.end())
+                continue;
+
+            // The directory itself is gone - So are its files.
+            if(p_event->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+            {
+                auto event = (p_event->mask & IN_DELETE_SELF)
+                    ? Event::Deleted
+                    : Event::Moved;
+
+                for(auto &file : it->second.files)
+                    AddPending(file.second, event);
+
+                LoseWatch(it);
+                continue;
+            }
+
+            // The kernel removed the watch (i.e. unmounted).
+            if(p_event->mask & IN_IGNORED)
+            {
+                LoseWatch(it);
+                continue;
+            }
+
+            if(p_event->len == 0)
+                continue;
+
+            auto file_it = it->second.files.find(p_event->name);
+            if(file_it != it->second.files.end())
+                AddPending(file_it->second, mask_to_event(p_event->mask));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Keeps the files of a watch whose directory is gone, so it can be
+// re-armed by RearmWatches - Must be called with the mutex locked.
+// COWNOTE(n2omatt): A moved directory is still watched by the kernel
+//   (at its new path), so the watch is removed explicitly - For the
+//   other cases it's already gone and this just fails with EINVAL.
+void FileWatcher::LoseWatch(std::map<int, DirectoryWatch>::iterator it)
+{
+    inotify_rm_watch(m_fd, it->first);
+
+    m_lostWatches.push_back(std::move(it->second));
+    m_watches.erase(it);
+}
+
+//------------------------------------------------------------------------------
+// Watches again the directories that are back at their paths - Must be
+// called with the mutex locked.
+void FileWatcher::RearmWatches()
+{
+    for(auto it = m_lostWatches.begin(); it != m_lostWatches.end(); /* Empty */)
+    {
+        auto wd = inotify_add_watch(m_fd, it->dirname.c_str(), kDirectoryMask);
+        if(wd == -1)
+        {
+            ++it; // Not back yet.
+            continue;
+        }
+
+        auto &watch = m_watches[wd];
+        if(watch.dirname.empty())
+            watch.dirname = it->dirname;
+
+        // The events between the removal and now were lost.
+        for(auto &file : it->files)
+        {
+            watch.files.insert(file);
+            if(access(file.second.c_str(), F_OK) == 0)
+                AddPending(file.second, Event::Created);
+        }
+
+        it = m_lostWatches.erase(it);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Coalesces the event with the pending one of the file and restarts its
+// debounce interval - Must be called with the mutex locked.
+void FileWatcher::AddPending(const std::string &filename, Event event)
+{
+    auto deadline = Clock::now() + m_debounce;
+
+    auto it = m_pending.find(filename);
+    if(it == m_pending.end())
+    {
+        m_pending[filename] = PendingEvent { event, deadline };
+        return;
+    }
+
+    auto &pending = it->second;
+    if(!(event == Event::Modified && pending.event == Event::Created))
+        pending.event = event;
+
+    pending.deadline = deadline;
+}
+
+//------------------------------------------------------------------------------
+void FileWatcher::ThreadLoop()
+{
+    struct pollfd fds[2];
+    fds[0].fd     = m_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd     = m_stopFd;
+    fds[1].events = POLLIN;
+
+    while(true)
+    {
+        fds[0].revents = 0;
+        fds[1].revents = 0;
+
+        auto result = poll(fds, 2, GetTimeout());
+        if(result == -1 && errno != EINTR)
+            return;
+
+        if(fds[1].revents & POLLIN)
+            return;
+
+        Process();
+    }
+}
@@ -0,0 +1,351 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Handle.cpp                                                    //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Handle.h"
+// std
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ios>
+#include <stdexcept>
+// POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// CoreFile
+#include "private/Posix_Helpers.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): Handle doesn't keep the filename (no allocations) -
+//   The shared helpers name the file by its descriptor in the messages.
+static const std::string kNoFilename;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Handle::Handle() :
+    // Members.
+    m_fd(-1)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+Handle::Handle(int fd) :
+    // Members.
+    m_fd(fd)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+Handle::Handle(
+    const std::string &filename,
+    OpenOptions        options,
+    mode_t             permissions) :
+    // Members.
+    m_fd(-1)
+{
+    COREASSERT_THROW_IF_NOT(
+        IsValidOpenOptions(options),
+        std::invalid_argument,
+        "Invalid open options - filename: (%s) - options: (0x%x)",
+        filename.c_str(),
+        static_cast<unsigned>(options)
+    );
+
+    // O_NOATIME is dropped by open_fd_exact when it isn't allowed.
+    m_fd = Private::open_fd_exact(
+        filename,
+        ToPosixFlags(options),
+        permissions
+    ).Release();
+}
+
+//------------------------------------------------------------------------------
+Handle::~Handle()
+{
+    Close();
+}
+
+//------------------------------------------------------------------------------
+Handle::Handle(Handle &&other) :
+    // Members.
+    m_fd(other.Release())
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+Handle& Handle::operator =(Handle &&other)
+{
+    if(this != &other)
+    {
+        Close();
+        m_fd = other.Release();
+    }
+    return *this;
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t Handle::Read(void *pData, size_t size)
+{
+    return Private::read_all(m_fd, pData, size, kNoFilename);
+}
+
+//------------------------------------------------------------------------------
+void Handle::Write(const void *pData, size_t size)
+{
+    Private::write_all(m_fd, pData, size, kNoFilename);
+}
+
+//------------------------------------------------------------------------------
+size_t Handle::ReadAt(void *pData, size_t size, uint64_t offset) const
+{
+    return Private::pread_all(m_fd, pData, size, offset, kNoFilename);
+}
+
+//------------------------------------------------------------------------------
+void Handle::WriteAt(const void *pData, size_t size, uint64_t offset) const
+{
+    Private::pwrite_all(m_fd, pData, size, offset, kNoFilename);
+}
+
+//------------------------------------------------------------------------------
+size_t Handle::ReadV(const struct iovec *pIov, int count)
+{
+    ssize_t n = -1;
+    do {
+        COREFILE_COUNT_SYSCALL();
+        n = readv(m_fd, pIov, std::min(count, IOV_MAX));
+    } while(n < 0 && errno == EINTR);
+
+    COREASSERT_THROW_IF_NOT(
+        n >= 0,
+        std::runtime_error,
+        "Failed to read file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+
+    return static_cast<size_t>(n);
+}
+
+//------------------------------------------------------------------------------
+void Handle::WriteV(const struct iovec *pIov, int count)
+{
+    Private::writev_all(m_fd, pIov, count, nullptr, kNoFilename);
+}
+
+//------------------------------------------------------------------------------
+size_t Handle::ReadVAt(
+    const struct iovec *pIov,
+    int                 count,
+    uint64_t            offset) const
+{
+    ssize_t n = -1;
+    do {
+        COREFILE_COUNT_SYSCALL();
+        n = preadv(
+            m_fd,
+            pIov,
+            std::min(count, IOV_MAX),
+            static_cast<off_t>(offset)
+        );
+    } while(n < 0 && errno == EINTR);
+
+    COREASSERT_THROW_IF_NOT(
+        n >= 0,
+        std::runtime_error,
+        "Failed to read file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+
+    return static_cast<size_t>(n);
+}
+
+//------------------------------------------------------------------------------
+void Handle::WriteVAt(
+    const struct iovec *pIov,
+    int                 count,
+    uint64_t            offset) const
+{
+    Private::writev_all(m_fd, pIov, count, &offset, kNoFilename);
+}
+
+//------------------------------------------------------------------------------
+uint64_t Handle::Seek(int64_t offset, int whence)
+{
+    auto position = lseek(m_fd, static_cast<off_t>(offset), whence);
+    COREASSERT_THROW_IF_NOT(
+        position != -1,
+        std::runtime_error,
+        "Failed to seek file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+
+    return static_cast<uint64_t>(position);
+}
+
+//------------------------------------------------------------------------------
+void Handle::Allocate(uint64_t offset, uint64_t length, bool keepSize)
+{
+    int result = 0;
+    do {
+        result = fallocate(
+            m_fd,
+            (keepSize) ? FALLOC_FL_KEEP_SIZE : 0,
+            static_cast<off_t>(offset),
+            static_cast<off_t>(length)
+        );
+    } while(result == -1 && errno == EINTR);
+
+    // posix_fallocate(3) emulates it writing the blocks, but it can't
+    // keep the size.
+    if(result == -1 && errno == EOPNOTSUPP && !keepSize)
+    {
+        errno = posix_fallocate(
+            m_fd,
+            static_cast<off_t>(offset),
+            static_cast<off_t>(length)
+        );
+        result = (errno == 0) ? 0 : -1;
+    }
+
+    COREASSERT_THROW_IF_NOT(
+        result == 0,
+        std::runtime_error,
+        "Failed to allocate file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+void Handle::Truncate(uint64_t size)
+{
+    int result = 0;
+    do {
+        result = ftruncate(m_fd, static_cast<off_t>(size));
+    } while(result == -1 && errno == EINTR);
+
+    COREASSERT_THROW_IF_NOT(
+        result == 0,
+        std::runtime_error,
+        "Failed to truncate file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+void Handle::DataSync()
+{
+    COREASSERT_THROW_IF_NOT(
+        fdatasync(m_fd) == 0,
+        std::runtime_error,
+        "Failed to sync file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+void Handle::Sync()
+{
+    COREASSERT_THROW_IF_NOT(
+        fsync(m_fd) == 0,
+        std::runtime_error,
+        "Failed to sync file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+void Handle::SetTimes(
+    const struct timespec *pAccessTime,
+    const struct timespec *pModifyTime)
+{
+    struct timespec times[2];
+    times[0].tv_sec  = 0;
+    times[0].tv_nsec = UTIME_OMIT;
+    times[1]         = times[0];
+
+    if(pAccessTime) times[0] = *pAccessTime;
+    if(pModifyTime) times[1] = *pModifyTime;
+
+    COREASSERT_THROW_IF_NOT(
+        futimens(m_fd, times) == 0,
+        std::runtime_error,
+        "Failed to set file times - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+size_t Handle::GetSize() const
+{
+    struct stat st;
+    COREASSERT_THROW_IF_NOT(
+        fstat(m_fd, &st) == 0,
+        std::runtime_error,
+        "Failed to stat file - filename: (%s) - error: (%s)",
+        Private::display_name(m_fd, kNoFilename).c_str(),
+        strerror(errno)
+    );
+
+    return static_cast<size_t>(st.st_size);
+}
+
+//------------------------------------------------------------------------------
+int Handle::Release()
+{
+    auto fd = m_fd;
+    m_fd    = -1;
+    return fd;
+}
+
+//------------------------------------------------------------------------------
+void Handle::Close()
+{
+    if(m_fd != -1)
+        close(m_fd);
+    m_fd = -1;
+}
@@ -0,0 +1,195 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : HandleStream.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/HandleStream.h"
+// std
+#include <algorithm>
+#include <cerrno>
+#include <exception>
+#include <utility>
+// POSIX
+#include <unistd.h>
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// HandleStreamBuf                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+HandleStreamBuf::HandleStreamBuf(Handle handle, size_t bufferSize) :
+    // Members.
+    m_handle    (std::move(handle)),
+    m_bufferSize(std::max<size_t>(1, bufferSize))
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+HandleStreamBuf::~HandleStreamBuf()
+{
+    FlushWriteBuffer();
+}
+
+//------------------------------------------------------------------------------
+HandleStreamBuf::int_type HandleStreamBuf::underflow()
+{
+    // Reading disables the put area, so the next write goes through
+    // overflow and repositions the descriptor first.
+    if(!FlushWriteBuffer())
+        return traits_type::eof();
+    setp(nullptr, nullptr);
+
+    if(gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+    if(m_readBuffer.empty())
+        m_readBuffer.resize(m_bufferSize);
+
+    ssize_t n = -1;
+    do {
+        n = read(m_handle.GetFd(), m_readBuffer.data(), m_readBuffer.size());
+    } while(n < 0 && errno == EINTR);
+
+    if(n <= 0)
+    {
+        setg(nullptr, nullptr, nullptr);
+        return traits_type::eof();
+    }
+
+    auto p_begin = m_readBuffer.data();
+    setg(p_begin, p_begin, p_begin + n);
+
+    return traits_type::to_int_type(*gptr());
+}
+
+//------------------------------------------------------------------------------
+HandleStreamBuf::int_type HandleStreamBuf::overflow(int_type c)
+{
+    // Same as underflow - Only one of the areas is active at time.
+    if(!DiscardReadBuffer() || !FlushWriteBuffer())
+        return traits_type::eof();
+
+    if(!pbase())
+    {
+        if(m_writeBuffer.empty())
+            m_writeBuffer.resize(m_bufferSize);
+
+        auto p_begin = m_writeBuffer.data();
+        setp(p_begin, p_begin + m_writeBuffer.size());
+    }
+
+    if(!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+}
+
+//------------------------------------------------------------------------------
+int HandleStreamBuf::sync()
+{
+    return (FlushWriteBuffer() && DiscardReadBuffer()) ? 0 : -1;
+}
+
+//------------------------------------------------------------------------------
+HandleStreamBuf::pos_type HandleStreamBuf::seekoff(
+    off_type                off,
+    std::ios_base::seekdir  dir,
+    std::ios_base::openmode /* which */)
+{
+    if(!FlushWriteBuffer())
+        return pos_type(off_type(-1));
+
+    // The descriptor is ahead of the logical position by the bytes
+    // that were buffered but not consumed yet.
+    auto whence = SEEK_SET;
+    if(dir == std::ios_base::cur)
+    {
+        whence = SEEK_CUR;
+        off   -= (egptr() - gptr());
+    }
+    else if(dir == std::ios_base::end)
+    {
+        whence = SEEK_END;
+    }
+
+    auto position = lseek(m_handle.GetFd(), off, whence);
+    if(position == -1)
+        return pos_type(off_type(-1));
+
+    setg(nullptr, nullptr, nullptr);
+    return pos_type(position);
+}
+
+//------------------------------------------------------------------------------
+HandleStreamBuf::pos_type HandleStreamBuf::seekpos(
+    pos_type                pos,
+    std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+//------------------------------------------------------------------------------
+bool HandleStreamBuf::FlushWriteBuffer()
+{
+    if(pbase() == pptr())
+        return true;
+
+    try {
+        m_handle.Write(pbase(), static_cast<size_t>(pptr() - pbase()));
+    } catch(const std::exception &) {
+        return false;
+    }
+
+    setp(pbase(), epptr());
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Moves the descriptor back to the logical position, so a write after
+// a read lands where the reader stopped.
+bool HandleStreamBuf::DiscardReadBuffer()
+{
+    auto unread = static_cast<off_t>(egptr() - gptr());
+    if(unread != 0 && lseek(m_handle.GetFd(), -unread, SEEK_CUR) == -1)
+        return false;
+
+    setg(nullptr, nullptr, nullptr);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// HandleStream                                                               //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+HandleStream::HandleStream(Handle handle, size_t bufferSize) :
+    // Base.
+    std::iostream(nullptr),
+    // Members.
+    m_buffer(std::move(handle), bufferSize)
+{
+    rdbuf(&m_buffer);
+}
@@ -0,0 +1,495 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Instrumentation.cpp                                           //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Instrumentation.h"
+// std
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <vector>
+// CoreFile
+#include "../include/CoreFile.h"
+#include "private/Instrumentation_Scope.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr size_t                    LatencyHistogram::kSubBucketCount;
+constexpr size_t                    LatencyHistogram::kBucketCount;
+constexpr std::chrono::milliseconds IoStatsExporter::kDefaultInterval;
+
+// log2(kSubBucketCount).
+constexpr size_t kSubBucketBits = 3;
+static_assert(
+    (size_t(1) << kSubBucketBits) == LatencyHistogram::kSubBucketCount,
+    "kSubBucketBits must match kSubBucketCount"
+);
+
+static const char* const kOperationNames[kIoOperationCount] = {
+    "open", "read_all", "write_all", "append", "copy", "move", "delete"
+};
+
+
+//----------------------------------------------------------------------------//
+// Slots                                                                      //
+//----------------------------------------------------------------------------//
+#if COREFILE_INSTRUMENTATION
+//------------------------------------------------------------------------------
+// Counters of a single operation - Only written by the thread that owns
+// the slot, so the updates are plain load + store (no lock prefix) and
+// the atomics are just to let GetIoStats read them meanwhile.
+struct OperationCounters
+{
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> syscalls;
+    std::atomic<uint64_t> latencySum;
+    std::atomic<uint64_t> buckets[LatencyHistogram::kBucketCount];
+};
+
+struct ThreadSlot
+{
+    std::atomic<bool> inUse;
+    OperationCounters operations[kIoOperationCount];
+};
+
+// COWNOTE(n2omatt): The slots of finished threads are kept (with their
+//   counts) and reused by the new ones, so there are never more slots
+//   than the peak of threads doing I/O.
+struct SlotRegistry
+{
+    std::mutex                               mutex;
+    std::vector<std::unique_ptr<ThreadSlot>> slots;
+    IoStats                                  baseline; // Set by ResetIoStats.
+};
+
+//------------------------------------------------------------------------------
+// Never destroyed - Threads may still do I/O while the statics go away.
+static SlotRegistry& get_registry()
+{
+    static auto s_pRegistry = new SlotRegistry();
+    return *s_pRegistry;
+}
+
+//------------------------------------------------------------------------------
+static ThreadSlot* acquire_slot()
+{
+    auto &registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for(auto &p_slot : registry.slots)
+    {
+        // Pairs with the release of SlotOwner - The counts written by
+        // the previous thread are visible to the new one.
+        if(!p_slot->inUse.load(std::memory_order_acquire))
+        {
+            p_slot->inUse.store(true, std::memory_order_release);
+            return p_slot.get();
+        }
+    }
+
+    // std::atomic isn't zeroed by the default constructor in C++11.
+    auto p_slot = std::unique_ptr<ThreadSlot>(new ThreadSlot());
+    std::memset(static_cast<void *>(p_slot.get()), 0, sizeof(ThreadSlot));
+    p_slot->inUse.store(true, std::memory_order_release);
+
+    registry.slots.push_back(std::move(p_slot));
+    return registry.slots.back().get();
+}
+
+//------------------------------------------------------------------------------
+// Gives the slot back when the thread finishes.
+struct SlotOwner
+{
+    ThreadSlot *pSlot;
+
+    ~SlotOwner()
+    {
+        if(pSlot)
+            pSlot->inUse.store(false, std::memory_order_release);
+    }
+
+    ThreadSlot& Get()
+    {
+        if(!pSlot)
+            pSlot = acquire_slot();
+        return *pSlot;
+    }
+};
+
+static thread_local SlotOwner t_slotOwner = { nullptr };
+static thread_local size_t    t_scopeDepth = 0;
+
+thread_local uint64_t CoreFile::Private::t_syscallCount = 0;
+thread_local uint64_t CoreFile::Private::t_byteCount    = 0;
+
+//------------------------------------------------------------------------------
+// COWNOTE(n2omatt): Comparing the count of the start with the one of the
+//   end tells if the operation itself threw - A plain "is there an
+//   exception in flight" is also true for operations that run (and
+//   succeed) in a destructor while another exception unwinds the stack.
+//   C++11 only has the plain one, so there the count is 0 or 1, which
+//   still gets those operations right unless they throw too.
+static int uncaught_exception_count()
+{
+#if defined(__cpp_lib_uncaught_exceptions)
+    return std::uncaught_exceptions();
+#else
+    return (std::uncaught_exception()) ? 1 : 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+static void subtract_stats(IoOperationStats &dst, const IoOperationStats &src)
+{
+    dst.calls         -= src.calls;
+    dst.errors        -= src.errors;
+    dst.bytes         -= src.bytes;
+    dst.syscalls      -= src.syscalls;
+    dst.latency.count -= src.latency.count;
+    dst.latency.sum   -= src.latency.sum;
+
+    for(size_t i = 0; i < LatencyHistogram::kBucketCount; ++i)
+        dst.latency.buckets[i] -= src.latency.buckets[i];
+}
+
+//------------------------------------------------------------------------------
+static void increment(std::atomic<uint64_t> &counter, uint64_t value)
+{
+    counter.store(
+        counter.load(std::memory_order_relaxed) + value,
+        std::memory_order_relaxed
+    );
+}
+
+//------------------------------------------------------------------------------
+// Sums all the slots, without the baseline - Registry must be locked.
+static IoStats sum_slots(SlotRegistry &registry)
+{
+    IoStats stats;
+    std::memset(&stats, 0, sizeof(stats));
+
+    for(auto &p_slot : registry.slots)
+    {
+        for(size_t op = 0; op < kIoOperationCount; ++op)
+        {
+            auto &src = p_slot->operations[op];
+            auto &dst = stats.operations[op];
+
+            dst.calls       += src.calls     .load(std::memory_order_relaxed);
+            dst.errors      += src.errors    .load(std::memory_order_relaxed);
+            dst.bytes       += src.bytes     .load(std::memory_order_relaxed);
+            dst.syscalls    += src.syscalls  .load(std::memory_order_relaxed);
+            dst.latency.sum += src.latencySum.load(std::memory_order_relaxed);
+
+            for(size_t i = 0; i < LatencyHistogram::kBucketCount; ++i)
+            {
+                auto count = src.buckets[i].load(std::memory_order_relaxed);
+                dst.latency.buckets[i] += count;
+                dst.latency.count      += count;
+            }
+        }
+    }
+
+    return stats;
+}
+
+
+//----------------------------------------------------------------------------//
+// OperationScope                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+Private::OperationScope::OperationScope(IoOperation operation) :
+    // Members.
+    m_operation         (operation),
+    m_outermost         (t_scopeDepth++ == 0),
+    m_uncaughtExceptions(uncaught_exception_count()),
+    m_startBytes        (t_byteCount),
+    m_startSyscalls     (t_syscallCount),
+    m_start             (std::chrono::steady_clock::now())
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+Private::OperationScope::~OperationScope()
+{
+    --t_scopeDepth;
+    if(!m_outermost)
+        return;
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - m_start
+    );
+    auto ns = static_cast<uint64_t>(elapsed.count());
+
+    auto &counters = t_slotOwner.Get().operations[static_cast<size_t>(m_operation)];
+    increment(counters.calls,      1);
+    increment(counters.bytes,      t_byteCount    - m_startBytes);
+    increment(counters.syscalls,   t_syscallCount - m_startSyscalls);
+    increment(counters.latencySum, ns);
+    increment(counters.buckets[LatencyHistogram::GetBucketIndex(ns)], 1);
+
+    if(uncaught_exception_count() > m_uncaughtExceptions)
+        increment(counters.errors, 1);
+}
+#endif // COREFILE_INSTRUMENTATION
+
+
+//----------------------------------------------------------------------------//
+// LatencyHistogram                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t LatencyHistogram::GetBucketIndex(uint64_t value)
+{
+    // The first buckets are exact.
+    if(value < kSubBucketCount)
+        return static_cast<size_t>(value);
+
+    // Then each power of two is split in kSubBucketCount buckets.
+    auto msb      = static_cast<size_t>(63 - __builtin_clzll(value));
+    auto shift    = msb - kSubBucketBits;
+    auto mantissa = static_cast<size_t>(value >> shift) & (kSubBucketCount - 1);
+
+    return (shift + 1) * kSubBucketCount + mantissa;
+}
+
+//------------------------------------------------------------------------------
+uint64_t LatencyHistogram::GetBucketLowerBound(size_t index)
+{
+    if(index < kSubBucketCount)
+        return index;
+
+    auto shift    = index / kSubBucketCount - 1;
+    auto mantissa = index % kSubBucketCount;
+
+    return static_cast<uint64_t>(kSubBucketCount + mantissa) << shift;
+}
+
+//------------------------------------------------------------------------------
+uint64_t LatencyHistogram::GetPercentile(double percentile) const
+{
+    if(count == 0)
+        return 0;
+
+    percentile = std::max(0.0, std::min(100.0, percentile));
+
+    auto target = static_cast<uint64_t>(percentile / 100.0 * count + 0.5);
+    target = std::max<uint64_t>(target, 1);
+
+    auto seen = uint64_t(0);
+    for(size_t i = 0; i < kBucketCount; ++i)
+    {
+        seen += buckets[i];
+        if(seen >= target)
+        {
+            // The highest value of the bucket.
+            return (i + 1 < kBucketCount)
+                ? GetBucketLowerBound(i + 1) - 1
+                : UINT64_MAX;
+        }
+    }
+
+    return UINT64_MAX;
+}
+
+
+//----------------------------------------------------------------------------//
+// Stats                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+const char* CoreFile::GetIoOperationName(IoOperation operation)
+{
+    return kOperationNames[static_cast<size_t>(operation)];
+}
+
+//------------------------------------------------------------------------------
+IoStats CoreFile::GetIoStats()
+{
+#if COREFILE_INSTRUMENTATION
+    auto &registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto stats = sum_slots(registry);
+    for(size_t op = 0; op < kIoOperationCount; ++op)
+        subtract_stats(stats.operations[op], registry.baseline.operations[op]);
+
+    return stats;
+#else
+    IoStats stats;
+    std::memset(&stats, 0, sizeof(stats));
+
+    return stats;
+#endif // COREFILE_INSTRUMENTATION
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::ResetIoStats()
+{
+#if COREFILE_INSTRUMENTATION
+    // COWNOTE(n2omatt): The slots are only written by their threads, so
+    //   instead of zeroing them the current sums become the baseline
+    //   that GetIoStats subtracts.
+    auto &registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.baseline = sum_slots(registry);
+#endif // COREFILE_INSTRUMENTATION
+}
+
+//------------------------------------------------------------------------------
+std::string CoreFile::IoStatsToText(const IoStats &stats)
+{
+    // Upper bounds of the exported latency buckets, in nanoseconds.
+    static const uint64_t kBoundsNs[] = {
+        1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 10000000000
+    };
+
+    std::string text;
+    char        line[256];
+
+    auto add_counter = [&](const char *pName, const char *pHelp, uint64_t IoOperationStats::*pField) {
+        snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s counter\n", pName, pHelp, pName);
+        text += line;
+
+        for(size_t op = 0; op < kIoOperationCount; ++op)
+        {
+            snprintf(
+                line, sizeof(line),
+                "%s{operation=\"%s\"} %" PRIu64 "\n",
+                pName,
+                kOperationNames[op],
+                stats.operations[op].*pField
+            );
+            text += line;
+        }
+    };
+
+    add_counter("corefile_calls_total",    "Number of calls.",              &IoOperationStats::calls   );
+    add_counter("corefile_errors_total",   "Number of calls that failed.",  &IoOperationStats::errors  );
+    add_counter("corefile_bytes_total",    "Bytes read, written or copied.", &IoOperationStats::bytes   );
+    add_counter("corefile_syscalls_total", "File related syscalls.",        &IoOperationStats::syscalls);
+
+    text += "# HELP corefile_latency_seconds Duration of the calls.\n";
+    text += "# TYPE corefile_latency_seconds histogram\n";
+    for(size_t op = 0; op < kIoOperationCount; ++op)
+    {
+        const auto &latency = stats.operations[op].latency;
+
+        // A bucket is counted under a bound when all of its values are.
+        size_t index = 0;
+        auto   below = uint64_t(0);
+        for(auto bound : kBoundsNs)
+        {
+            while(index + 1 < LatencyHistogram::kBucketCount &&
+                  LatencyHistogram::GetBucketLowerBound(index + 1) - 1 <= bound)
+            {
+                below += latency.buckets[index++];
+            }
+
+            snprintf(
+                line, sizeof(line),
+                "corefile_latency_seconds_bucket{operation=\"%s\",le=\"%g\"} %" PRIu64 "\n",
+                kOperationNames[op],
+                static_cast<double>(bound) / 1e9,
+                below
+            );
+            text += line;
+        }
+
+        snprintf(
+            line, sizeof(line),
+            "corefile_latency_seconds_bucket{operation=\"%s\",le=\"+Inf\"} %" PRIu64 "\n"
+            "corefile_latency_seconds_sum{operation=\"%s\"} %.9f\n"
+            "corefile_latency_seconds_count{operation=\"%s\"} %" PRIu64 "\n",
+            kOperationNames[op], latency.count,
+            kOperationNames[op], static_cast<double>(latency.sum) / 1e9,
+            kOperationNames[op], latency.count
+        );
+        text += line;
+    }
+
+    return text;
+}
+
+
+//----------------------------------------------------------------------------//
+// IoStatsExporter                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+IoStatsExporter::IoStatsExporter(
+    const std::string         &filename,
+    std::chrono::milliseconds  interval /* = kDefaultInterval */) :
+    // Members.
+    m_filename(filename),
+    m_interval(interval),
+    m_stop    (false)
+{
+    m_thread = std::thread(&IoStatsExporter::ThreadLoop, this);
+}
+
+//------------------------------------------------------------------------------
+IoStatsExporter::~IoStatsExporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_stopCondition.notify_all();
+    m_thread.join();
+
+    try {
+        Export();
+    } catch(const std::exception &) {
+        // Destructors must not throw.
+    }
+}
+
+//------------------------------------------------------------------------------
+void IoStatsExporter::Export()
+{
+    WriteAllText(m_filename, IoStatsToText(GetIoStats()), WriteMode::Atomic);
+}
+
+//------------------------------------------------------------------------------
+void IoStatsExporter::ThreadLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(!m_stopCondition.wait_for(lock, m_interval, [this]() { return m_stop; }))
+    {
+        lock.unlock();
+        try {
+            Export();
+        } catch(const std::exception &) {
+            // Keep trying - The directory may come back.
+        }
+        lock.lock();
+    }
+}
@@ -0,0 +1,360 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineIndex.cpp                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/LineIndex.h"
+// CoreFile
+#include "../include/Backend.h"
+#include "../include/Handle.h"
+#include "../include/MappedFile.h"
+#include "private/Newline_Scanner.h"
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Sidecar layout (native byte order):
+//   magic[8] | file_size u64 | mtime_sec i64 | mtime_nsec i64 |
+//   content_end u64 | count u64 | offsets u64[count]
+static const char   kSidecarMagic[8]  = { 'C', 'F', 'L', 'I', 'D', 'X', '0', '1' };
+static const size_t kSidecarHeaderSize = 8 + 5 * sizeof(uint64_t);
+static const char  *kSidecarExtension  = ".lidx";
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void get_mtime(const struct stat &st, int64_t &sec, int64_t &nsec)
+{
+#if defined(__APPLE__)
+    sec  = st.st_mtimespec.tv_sec;
+    nsec = st.st_mtimespec.tv_nsec;
+#else
+    sec  = st.st_mtim.tv_sec;
+    nsec = st.st_mtim.tv_nsec;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// COWNOTE(n2omatt): A stale or hand edited sidecar may still have the
+//   right size / mtime - Offsets that don't fit the file would give
+//   garbage slices (or out of range reads), so they're checked too.
+static bool offsets_fit_file(
+    const std::vector<uint64_t> &offsets,
+    uint64_t                     fileSize,
+    uint64_t                     contentEnd)
+{
+    // Only a trailing '\n' may be left out of the content.
+    if(contentEnd > fileSize || fileSize - contentEnd > 1)
+        return false;
+
+    if(offsets.empty())
+        return fileSize == 0;
+    if(offsets[0] != 0 || offsets.back() > contentEnd)
+        return false;
+
+    // Each line starts after the '\n' of the previous one.
+    for(size_t i = 1; i < offsets.size(); ++i)
+    {
+        if(offsets[i] <= offsets[i - 1])
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+static bool read_exact(int fd, void *pData, size_t size)
+{
+    auto p_curr = static_cast<char *>(pData);
+    while(size > 0)
+    {
+        auto n = read(fd, p_curr, size);
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            return false;
+
+        p_curr += n;
+        size   -= n;
+    }
+
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+LineIndex::LineIndex() :
+    // Members.
+    m_fileSize  (0),
+    m_mtimeSec  (0),
+    m_mtimeNsec (0),
+    m_contentEnd(0)
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Static Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+LineIndex LineIndex::Build(const std::string &filename)
+{
+    LineIndex index;
+    index.m_filename = filename;
+
+    MappedFile mapped(filename, MappedFile::Advice::Sequential);
+
+    // COWNOTE(n2omatt): Stat after mapping so a concurrent writer makes
+    //   the index look stale instead of looking valid with wrong offsets.
+    index.m_pHandle = std::make_shared<Handle>(
+        Private::open_fd(filename, O_RDONLY).Release()
+    );
+    auto st = Private::fd_stat(index.m_pHandle->GetFd(), filename);
+    get_mtime(st, index.m_mtimeSec, index.m_mtimeNsec);
+    index.m_fileSize   = mapped.Size();
+    index.m_contentEnd = mapped.Size();
+
+    if(mapped.IsEmpty())
+        return index;
+
+    auto p_data = reinterpret_cast<const char *>(mapped.Data());
+    auto size   = mapped.Size();
+
+    index.m_offsets.push_back(0);
+    Private::scan_newlines(p_data, size, 0, index.m_offsets);
+
+    // A trailing '\n' doesn't start a new line.
+    if(index.m_offsets.back() == size)
+    {
+        index.m_offsets.pop_back();
+        index.m_contentEnd = size - 1;
+    }
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+bool LineIndex::Load(
+    const std::string &filename,
+    LineIndex         &index,
+    const std::string &indexFilename /* = "" */)
+{
+    auto sidecar = indexFilename.empty()
+        ? GetSidecarFilename(filename)
+        : indexFilename;
+
+    auto fd = open(sidecar.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd == -1)
+        return false;
+    Private::ScopedFd sidecar_fd(fd);
+
+    // The file is kept open for ReadLine - So it's the one that's stat'ed.
+    auto file_fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if(file_fd == -1)
+        return false;
+    auto p_handle = std::make_shared<Handle>(file_fd);
+
+    struct stat st;
+    if(fstat(file_fd, &st) != 0)
+        return false;
+
+    //--------------------------------------------------------------------------
+    // Header.
+    char     magic[8];
+    uint64_t header[5];
+    if(!read_exact(fd, magic,  sizeof(magic))  ||
+       !read_exact(fd, header, sizeof(header)) ||
+       memcmp(magic, kSidecarMagic, sizeof(magic)) != 0)
+    {
+        return false;
+    }
+
+    LineIndex loaded;
+    loaded.m_filename   = filename;
+    loaded.m_pHandle    = p_handle;
+    loaded.m_fileSize   = header[0];
+    loaded.m_mtimeSec   = static_cast<int64_t>(header[1]);
+    loaded.m_mtimeNsec  = static_cast<int64_t>(header[2]);
+    loaded.m_contentEnd = header[3];
+
+    //--------------------------------------------------------------------------
+    // Stale check.
+    int64_t mtime_sec, mtime_nsec;
+    get_mtime(st, mtime_sec, mtime_nsec);
+
+    if(loaded.m_fileSize  != static_cast<uint64_t>(st.st_size) ||
+       loaded.m_mtimeSec  != mtime_sec                         ||
+       loaded.m_mtimeNsec != mtime_nsec)
+    {
+        return false;
+    }
+
+    //--------------------------------------------------------------------------
+    // Offsets.
+    // COWNOTE(n2omatt): The count is checked against what the sidecar
+    //   can hold before multiplying - A corrupted one would wrap the
+    //   expected size around and pass the check.
+    auto count        = header[4];
+    auto sidecar_stat = Private::fd_stat(fd, sidecar);
+    auto sidecar_size = static_cast<uint64_t>(sidecar_stat.st_size);
+    if(sidecar_size < kSidecarHeaderSize ||
+       count > (sidecar_size - kSidecarHeaderSize) / sizeof(uint64_t))
+    {
+        return false;
+    }
+
+    if(sidecar_size != kSidecarHeaderSize + count * sizeof(uint64_t))
+        return false;
+
+    loaded.m_offsets.resize(count);
+    if(count != 0 && !read_exact(fd, loaded.m_offsets.data(), count * sizeof(uint64_t)))
+        return false;
+
+    if(!offsets_fit_file(loaded.m_offsets, loaded.m_fileSize, loaded.m_contentEnd))
+        return false;
+
+    index = std::move(loaded);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+LineIndex LineIndex::LoadOrBuild(
+    const std::string &filename,
+    const std::string &indexFilename /* = "" */)
+{
+    LineIndex index;
+    if(Load(filename, index, indexFilename))
+        return index;
+
+    index = Build(filename);
+    index.Save(indexFilename);
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+std::string LineIndex::GetSidecarFilename(const std::string &filename)
+{
+    return filename + kSidecarExtension;
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void LineIndex::Save(const std::string &indexFilename /* = "" */) const
+{
+    auto sidecar = indexFilename.empty()
+        ? GetSidecarFilename(m_filename)
+        : indexFilename;
+
+    uint64_t header[5] = {
+        m_fileSize,
+        static_cast<uint64_t>(m_mtimeSec),
+        static_cast<uint64_t>(m_mtimeNsec),
+        m_contentEnd,
+        static_cast<uint64_t>(m_offsets.size())
+    };
+
+    std::string contents;
+    contents.reserve(kSidecarHeaderSize + m_offsets.size() * sizeof(uint64_t));
+    contents.append(kSidecarMagic, sizeof(kSidecarMagic));
+    contents.append(reinterpret_cast<const char *>(header), sizeof(header));
+    contents.append(
+        reinterpret_cast<const char *>(m_offsets.data()),
+        m_offsets.size() * sizeof(uint64_t)
+    );
+
+    // COWNOTE(n2omatt): Straight to the disk (Load reads it from there)
+    //   and atomically, so a crash leaves the old sidecar or the new one.
+    GetPosixBackend().WriteFile(
+        sidecar,
+        contents.data(),
+        contents.size(),
+        WriteMode::Atomic,
+        Durability::None
+    );
+}
+
+//------------------------------------------------------------------------------
+uint64_t LineIndex::GetLineOffset(size_t lineNumber) const
+{
+    COREASSERT_THROW_IF_NOT(
+        lineNumber < m_offsets.size(),
+        std::out_of_range,
+        "Line number out of range - line: (%zu) - count: (%zu)",
+        lineNumber,
+        m_offsets.size()
+    );
+
+    return m_offsets[lineNumber];
+}
+
+//------------------------------------------------------------------------------
+uint64_t LineIndex::GetLineLength(size_t lineNumber) const
+{
+    auto beg = GetLineOffset(lineNumber);
+
+    // The last line may or may not end with a '\n'.
+    if(lineNumber + 1 == m_offsets.size())
+        return m_contentEnd - beg;
+
+    return m_offsets[lineNumber + 1] - beg - 1;
+}
+
+//------------------------------------------------------------------------------
+std::string LineIndex::ReadLine(size_t lineNumber) const
+{
+    auto offset = GetLineOffset(lineNumber);
+    auto length = GetLineLength(lineNumber);
+
+    std::string line(length, '\0');
+    auto n = m_pHandle->ReadAt(&line[0], length, offset);
+    COREASSERT_THROW_IF_NOT(
+        n == length,
+        std::runtime_error,
+        "Failed to read line, file was truncated - filename: (%s) - line: (%zu)",
+        m_filename.c_str(),
+        lineNumber
+    );
+
+    return line;
+}
+
+
+//----------------------------------------------------------------------------//
+// Free Functions                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<uint64_t> CoreFile::BuildLineIndex(const std::string &filename)
+{
+    return LineIndex::Build(filename).GetOffsets();
+}
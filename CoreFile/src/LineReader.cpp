@@ -0,0 +1,131 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineReader.cpp                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/LineReader.h"
+// CoreFile
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+LineReader::LineReader(
+    const std::string &filename,
+    size_t             bufferSize /* = kDefaultBufferSize */) :
+    // Members.
+    m_filename  (filename),
+    m_handle    (Private::open_fd(filename, O_RDONLY).Release()),
+    m_buffer    (std::max<size_t>(bufferSize, 1)),
+    m_begin     (0),
+    m_scanned   (0),
+    m_end       (0),
+    m_eof       (false),
+    m_lineNumber(0)
+{
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(m_handle.GetFd(), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool LineReader::Next(Line &line)
+{
+    while(true)
+    {
+        // COWNOTE(n2omatt): memchr(3) is vectorized by the libc, so it's
+        //   the fastest portable way to find the newlines.
+        auto p_base = m_buffer.data();
+        auto p_nl   = static_cast<const char *>(
+            memchr(p_base + m_scanned, '\n', m_end - m_scanned)
+        );
+
+        if(p_nl)
+        {
+            line.pData = p_base + m_begin;
+            line.size  = (p_nl - p_base) - m_begin;
+
+            m_begin   = (p_nl - p_base) + 1;
+            m_scanned = m_begin;
+            ++m_lineNumber;
+
+            return true;
+        }
+        m_scanned = m_end;
+
+        // Last line without the trailing '\n'.
+        if(m_eof)
+        {
+            if(m_begin == m_end)
+                return false;
+
+            line.pData = p_base + m_begin;
+            line.size  = m_end  - m_begin;
+
+            m_begin = m_scanned = m_end;
+            ++m_lineNumber;
+
+            return true;
+        }
+
+        Refill();
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void LineReader::Refill()
+{
+    // Move the partial line to the start of the buffer.
+    if(m_begin > 0)
+    {
+        memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+        m_end     -= m_begin;
+        m_scanned -= m_begin;
+        m_begin    = 0;
+    }
+
+    // A single line is bigger than the whole buffer.
+    if(m_end == m_buffer.size())
+        m_buffer.resize(m_buffer.size() * 2);
+
+    // A short read means EOF - Saves the extra read(2) that returns 0.
+    auto size = m_buffer.size() - m_end;
+    auto n    = Private::read_all(
+        m_handle.GetFd(),
+        m_buffer.data() + m_end,
+        size,
+        m_filename
+    );
+
+    m_end += n;
+    m_eof  = (n < size);
+}
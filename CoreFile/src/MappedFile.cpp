@@ -0,0 +1,157 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : MappedFile.cpp                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/MappedFile.h"
+// POSIX
+#include <sys/mman.h>
+// CoreFile
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static int advice_to_madvise(MappedFile::Advice advice)
+{
+    switch(advice)
+    {
+        case MappedFile::Advice::Normal     : return MADV_NORMAL;
+        case MappedFile::Advice::Sequential : return MADV_SEQUENTIAL;
+        case MappedFile::Advice::Random     : return MADV_RANDOM;
+        case MappedFile::Advice::WillNeed   : return MADV_WILLNEED;
+        case MappedFile::Advice::DontNeed   : return MADV_DONTNEED;
+    }
+
+    return MADV_NORMAL;
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+MappedFile::MappedFile(
+    const std::string &filename,
+    Advice             advice /* = Advice::Normal */) :
+    // Members.
+    m_filename(filename),
+    m_pData   (nullptr),
+    m_size    (0)
+{
+    auto fd = Private::open_fd(filename, O_RDONLY);
+    m_size  = Private::fd_size(fd.Get(), filename);
+
+    // COWNOTE(n2omatt): mmap(2) fails with EINVAL for zero length mappings.
+    //   Empty files are represented by a nullptr / 0 size view.
+    if(m_size == 0)
+        return;
+
+    auto p_addr = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd.Get(), 0);
+    COREASSERT_THROW_IF_NOT(
+        p_addr != MAP_FAILED,
+        std::runtime_error,
+        "Failed to map file - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(errno)
+    );
+
+    // The mapping keeps a reference to the file, so the fd can be closed.
+    m_pData = static_cast<byte_t *>(p_addr);
+
+    if(advice != Advice::Normal)
+        Advise(advice);
+}
+
+//------------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+//------------------------------------------------------------------------------
+MappedFile::MappedFile(MappedFile &&other) :
+    // Members.
+    m_filename(std::move(other.m_filename)),
+    m_pData   (other.m_pData),
+    m_size    (other.m_size)
+{
+    other.m_pData = nullptr;
+    other.m_size  = 0;
+}
+
+//------------------------------------------------------------------------------
+MappedFile& MappedFile::operator =(MappedFile &&other)
+{
+    if(this == &other)
+        return *this;
+
+    Unmap();
+
+    m_filename = std::move(other.m_filename);
+    m_pData    = other.m_pData;
+    m_size     = other.m_size;
+
+    other.m_pData = nullptr;
+    other.m_size  = 0;
+
+    return *this;
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void MappedFile::Advise(
+    Advice advice,
+    size_t offset /* = 0 */,
+    size_t length /* = 0 */) const
+{
+    if(m_pData == nullptr || offset >= m_size)
+        return;
+
+    // madvise(2) requires a page aligned address.
+    auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto aligned   = offset - (offset % page_size);
+
+    if(length == 0 || offset + length > m_size)
+        length = m_size - offset;
+    length += (offset - aligned);
+
+    madvise(m_pData + aligned, length, advice_to_madvise(advice));
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void MappedFile::Unmap()
+{
+    if(m_pData != nullptr)
+        munmap(m_pData, m_size);
+
+    m_pData = nullptr;
+    m_size  = 0;
+}
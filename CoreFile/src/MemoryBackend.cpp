@@ -0,0 +1,279 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : MemoryBackend.cpp                                             //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+
+// Header
+#include "../include/MemoryBackend.h"
+// std
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <ios>
+#include <stdexcept>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr size_t MemoryBackend::kDefaultStripeCount;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+MemoryBackend::MemoryBackend(size_t stripeCount) :
+    // Members.
+    m_stripes(std::max<size_t>(stripeCount, 1))
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Backend                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool MemoryBackend::ReadFile(const std::string &filename, std::string &contents)
+{
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.files.find(filename);
+    if(it == stripe.files.end())
+    {
+        contents.clear();
+        return false;
+    }
+
+    contents = it->second;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool MemoryBackend::ReadFile(
+    const std::string   &filename,
+    std::vector<byte_t> &contents)
+{
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.files.find(filename);
+    if(it == stripe.files.end())
+    {
+        contents.clear();
+        return false;
+    }
+
+    contents.assign(it->second.begin(), it->second.end());
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void MemoryBackend::WriteFile(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    WriteMode          /* mode */,
+    Durability         /* durability */)
+{
+    // COWNOTE(n2omatt): Build the contents before taking the lock.
+    auto p_data = static_cast<const char *>(pData);
+    std::string contents(p_data, p_data + size);
+
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    stripe.files[filename].swap(contents);
+}
+
+//------------------------------------------------------------------------------
+void MemoryBackend::AppendFile(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size)
+{
+    auto p_data = static_cast<const char *>(pData);
+
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    stripe.files[filename].append(p_data, size);
+}
+
+//------------------------------------------------------------------------------
+bool MemoryBackend::DeleteFile(const std::string &filename)
+{
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    return stripe.files.erase(filename) != 0;
+}
+
+//------------------------------------------------------------------------------
+bool MemoryBackend::IsFile(const std::string &filename)
+{
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    return stripe.files.count(filename) != 0;
+}
+
+//------------------------------------------------------------------------------
+size_t MemoryBackend::GetFileSize(const std::string &filename)
+{
+    auto &stripe = GetStripe(filename);
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+
+    auto it = stripe.files.find(filename);
+    return (it != stripe.files.end()) ? it->second.size() : 0;
+}
+
+//------------------------------------------------------------------------------
+void MemoryBackend::CopyFile(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite)
+{
+    COREASSERT_THROW_IF_NOT(
+        src != dst,
+        std::invalid_argument,
+        "Source and destination are the same file - src: (%s) - dst: (%s)",
+        src.c_str(),
+        dst.c_str()
+    );
+
+    Transfer(src, dst, overwrite, false);
+}
+
+//------------------------------------------------------------------------------
+void MemoryBackend::MoveFile(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite)
+{
+    if(src == dst && IsFile(src))
+        return; // Same of rename(2).
+
+    Transfer(src, dst, overwrite, true);
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<std::string> MemoryBackend::GetFilenames()
+{
+    std::vector<std::string> filenames;
+    for(auto &stripe : m_stripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for(const auto &pair : stripe.files)
+            filenames.push_back(pair.first);
+    }
+
+    std::sort(filenames.begin(), filenames.end());
+    return filenames;
+}
+
+//------------------------------------------------------------------------------
+void MemoryBackend::Clear()
+{
+    for(auto &stripe : m_stripes)
+    {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        stripe.files.clear();
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+MemoryBackend::Stripe& MemoryBackend::GetStripe(const std::string &filename)
+{
+    auto index = std::hash<std::string>()(filename) % m_stripes.size();
+    return m_stripes[index];
+}
+
+//------------------------------------------------------------------------------
+void MemoryBackend::Transfer(
+    const std::string &src,
+    const std::string &dst,
+    bool               overwrite,
+    bool               removeSource)
+{
+    auto &src_stripe = GetStripe(src);
+    auto &dst_stripe = GetStripe(dst);
+
+    // COWNOTE(n2omatt): Both stripes are held so the other threads see
+    //   the file either in src or in dst, never in both / neither.
+    //   std::lock takes them without deadlocking against the opposite
+    //   transfer.
+    std::unique_lock<std::mutex> src_lock(src_stripe.mutex, std::defer_lock);
+    std::unique_lock<std::mutex> dst_lock;
+    if(&src_stripe == &dst_stripe)
+    {
+        src_lock.lock();
+    }
+    else
+    {
+        dst_lock = std::unique_lock<std::mutex>(dst_stripe.mutex, std::defer_lock);
+        std::lock(src_lock, dst_lock);
+    }
+
+    auto src_it = src_stripe.files.find(src);
+    COREASSERT_THROW_IF_NOT(
+        src_it != src_stripe.files.end(),
+        std::ios::failure,
+        "Failed to open file - filename: (%s) - error: (%s)",
+        src.c_str(),
+        strerror(ENOENT)
+    );
+    COREASSERT_THROW_IF_NOT(
+        overwrite || dst_stripe.files.count(dst) == 0,
+        std::ios::failure,
+        "Failed to open file - filename: (%s) - error: (%s)",
+        dst.c_str(),
+        strerror(EEXIST)
+    );
+
+    if(!removeSource)
+    {
+        dst_stripe.files[dst] = src_it->second;
+        return;
+    }
+
+    // Take the contents out first - Inserting dst may rehash the
+    // stripe and invalidate src_it.
+    std::string contents;
+    contents.swap(src_it->second);
+    src_stripe.files.erase(src_it);
+
+    dst_stripe.files[dst].swap(contents);
+}
@@ -0,0 +1,193 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Metadata.cpp                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Metadata.h"
+// std
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+// POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+// CoreFile
+#include "private/Parallel_For.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Files stat'ed by a thread at a time.
+constexpr size_t kStatBlockSize = 64;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+#if defined(STATX_BASIC_STATS)
+//------------------------------------------------------------------------------
+static struct timespec to_timespec(const struct statx_timestamp &ts)
+{
+    struct timespec result;
+    result.tv_sec  = static_cast<time_t>(ts.tv_sec);
+    result.tv_nsec = static_cast<long  >(ts.tv_nsec);
+
+    return result;
+}
+#endif // defined(STATX_BASIC_STATS)
+
+//------------------------------------------------------------------------------
+// Fills the metadata - Returns 0 or the errno of the failure.
+// COWNOTE(n2omatt): statx(2) needs glibc 2.28 and Linux 4.11, older
+//   ones fall back to a plain stat(2), which lacks the birth time.
+static int get_metadata(
+    const char   *pFilename,
+    bool          followSymlinks,
+    FileMetadata &metadata)
+{
+    std::memset(&metadata, 0, sizeof(metadata));
+
+#if defined(STATX_BASIC_STATS)
+    struct statx stx;
+    auto flags = AT_STATX_SYNC_AS_STAT
+               | ((followSymlinks) ? 0 : AT_SYMLINK_NOFOLLOW);
+
+    if(statx(AT_FDCWD, pFilename, flags, STATX_BASIC_STATS | STATX_BTIME, &stx) == 0)
+    {
+        metadata.size   = stx.stx_size;
+        metadata.mode   = stx.stx_mode;
+        metadata.links  = stx.stx_nlink;
+        metadata.inode  = stx.stx_ino;
+        metadata.device = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+        metadata.uid    = stx.stx_uid;
+        metadata.gid    = stx.stx_gid;
+
+        metadata.accessTime = to_timespec(stx.stx_atime);
+        metadata.modifyTime = to_timespec(stx.stx_mtime);
+        metadata.changeTime = to_timespec(stx.stx_ctime);
+
+        metadata.hasBirthTime = (stx.stx_mask & STATX_BTIME) != 0;
+        if(metadata.hasBirthTime)
+            metadata.birthTime = to_timespec(stx.stx_btime);
+
+        return 0;
+    }
+
+    if(errno != ENOSYS)
+        return errno;
+#endif // defined(STATX_BASIC_STATS)
+
+    struct stat st;
+    auto result = (followSymlinks)
+        ? stat (pFilename, &st)
+        : lstat(pFilename, &st);
+
+    if(result != 0)
+        return errno;
+
+    metadata.size   = static_cast<uint64_t>(st.st_size);
+    metadata.mode   = st.st_mode;
+    metadata.links  = static_cast<uint32_t>(st.st_nlink);
+    metadata.inode  = st.st_ino;
+    metadata.device = st.st_dev;
+    metadata.uid    = st.st_uid;
+    metadata.gid    = st.st_gid;
+
+    metadata.accessTime = st.st_atim;
+    metadata.modifyTime = st.st_mtim;
+    metadata.changeTime = st.st_ctim;
+
+    return 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// FileMetadata                                                               //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool FileMetadata::IsFile() const
+{
+    return IsValid() && S_ISREG(mode);
+}
+
+//------------------------------------------------------------------------------
+bool FileMetadata::IsDirectory() const
+{
+    return IsValid() && S_ISDIR(mode);
+}
+
+//------------------------------------------------------------------------------
+bool FileMetadata::IsSymlink() const
+{
+    return IsValid() && S_ISLNK(mode);
+}
+
+
+//----------------------------------------------------------------------------//
+// Metadata                                                                   //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+FileMetadata CoreFile::GetMetadata(
+    const std::string &filename,
+    bool               followSymlinks)
+{
+    FileMetadata metadata;
+    auto error = get_metadata(filename.c_str(), followSymlinks, metadata);
+
+    COREASSERT_THROW_IF_NOT(
+        error == 0,
+        std::runtime_error,
+        "Failed to stat file - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(error)
+    );
+
+    return metadata;
+}
+
+//------------------------------------------------------------------------------
+std::vector<FileMetadata> CoreFile::GetMetadata(
+    const std::vector<std::string> &filenames,
+    size_t                          threads,
+    bool                            followSymlinks)
+{
+    std::vector<FileMetadata> result(filenames.size());
+
+    Private::parallel_for(
+        filenames.size(),
+        threads,
+        kStatBlockSize,
+        [&](size_t i) {
+            result[i].error = get_metadata(
+                filenames[i].c_str(),
+                followSymlinks,
+                result[i]
+            );
+        }
+    );
+
+    return result;
+}
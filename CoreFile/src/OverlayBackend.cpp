@@ -0,0 +1,174 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OverlayBackend.cpp                                            //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+
+// Header
+#include "../include/OverlayBackend.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+OverlayBackend::OverlayBackend(Backend &upper, Backend &lower) :
+    // Members.
+    m_upper(upper),
+    m_lower(lower)
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Backend                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool OverlayBackend::ReadFile(const std::string &filename, std::string &contents)
+{
+    return ReadFileT(filename, contents);
+}
+
+//------------------------------------------------------------------------------
+bool OverlayBackend::ReadFile(
+    const std::string   &filename,
+    std::vector<byte_t> &contents)
+{
+    return ReadFileT(filename, contents);
+}
+
+//------------------------------------------------------------------------------
+void OverlayBackend::WriteFile(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size,
+    WriteMode          mode,
+    Durability         durability)
+{
+    m_upper.WriteFile(filename, pData, size, mode, durability);
+    RemoveWhiteout(filename);
+}
+
+//------------------------------------------------------------------------------
+void OverlayBackend::AppendFile(
+    const std::string &filename,
+    const void        *pData,
+    size_t             size)
+{
+    // Copy up - The lower one is never modified.
+    if(!m_upper.IsFile(filename) && !IsWhiteout(filename))
+    {
+        std::string contents;
+        if(m_lower.ReadFile(filename, contents))
+        {
+            m_upper.WriteFile(
+                filename,
+                contents.data(),
+                contents.size(),
+                WriteMode::Truncate,
+                Durability::None
+            );
+        }
+    }
+
+    m_upper.AppendFile(filename, pData, size);
+    RemoveWhiteout(filename);
+}
+
+//------------------------------------------------------------------------------
+bool OverlayBackend::DeleteFile(const std::string &filename)
+{
+    auto in_upper = m_upper.DeleteFile(filename);
+    auto in_lower = !IsWhiteout(filename) && m_lower.IsFile(filename);
+
+    if(in_lower)
+        AddWhiteout(filename);
+
+    return in_upper || in_lower;
+}
+
+//------------------------------------------------------------------------------
+bool OverlayBackend::IsFile(const std::string &filename)
+{
+    if(m_upper.IsFile(filename))
+        return true;
+
+    return !IsWhiteout(filename) && m_lower.IsFile(filename);
+}
+
+//------------------------------------------------------------------------------
+size_t OverlayBackend::GetFileSize(const std::string &filename)
+{
+    if(m_upper.IsFile(filename))
+        return m_upper.GetFileSize(filename);
+
+    return (!IsWhiteout(filename)) ? m_lower.GetFileSize(filename) : 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<std::string> OverlayBackend::GetWhiteouts()
+{
+    std::lock_guard<std::mutex> lock(m_whiteoutsMutex);
+    return std::vector<std::string>(m_whiteouts.begin(), m_whiteouts.end());
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool OverlayBackend::IsWhiteout(const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(m_whiteoutsMutex);
+    return m_whiteouts.count(filename) != 0;
+}
+
+//------------------------------------------------------------------------------
+void OverlayBackend::AddWhiteout(const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(m_whiteoutsMutex);
+    m_whiteouts.insert(filename);
+}
+
+//------------------------------------------------------------------------------
+void OverlayBackend::RemoveWhiteout(const std::string &filename)
+{
+    std::lock_guard<std::mutex> lock(m_whiteoutsMutex);
+    m_whiteouts.erase(filename);
+}
+
+//------------------------------------------------------------------------------
+template <typename Container>
+bool OverlayBackend::ReadFileT(const std::string &filename, Container &contents)
+{
+    if(m_upper.ReadFile(filename, contents))
+        return true;
+
+    if(IsWhiteout(filename))
+        return false;
+
+    return m_lower.ReadFile(filename, contents);
+}
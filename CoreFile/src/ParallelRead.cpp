@@ -0,0 +1,236 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParallelRead.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/ParallelRead.h"
+// std
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+// CoreFile
+#include "private/Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+struct Chunk
+{
+    uint64_t offset;
+    size_t   size;
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static size_t resolve_thread_count(size_t threads, size_t chunksCount)
+{
+    if(threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    return std::max<size_t>(1, std::min(threads, chunksCount));
+}
+
+//------------------------------------------------------------------------------
+// Finds the offset right after the first '\n' at or after offset.
+// Returns fileSize if there's no newline.
+static uint64_t find_line_end(
+    int                fd,
+    uint64_t           offset,
+    uint64_t           fileSize,
+    const std::string &filename)
+{
+    char buffer[64 * 1024];
+    while(offset < fileSize)
+    {
+        auto n = Private::pread_all(fd, buffer, sizeof(buffer), offset, filename);
+        if(n == 0)
+            break;
+
+        auto p_nl = static_cast<const char *>(memchr(buffer, '\n', n));
+        if(p_nl)
+            return offset + (p_nl - buffer) + 1;
+
+        offset += n;
+    }
+
+    return fileSize;
+}
+
+//------------------------------------------------------------------------------
+static std::vector<Chunk> split_in_chunks(
+    int                fd,
+    uint64_t           fileSize,
+    size_t             chunkSize,
+    ChunkSplit         split,
+    const std::string &filename)
+{
+    std::vector<Chunk> chunks;
+    chunks.reserve(fileSize / chunkSize + 1);
+
+    uint64_t offset = 0;
+    while(offset < fileSize)
+    {
+        uint64_t end = std::min<uint64_t>(offset + chunkSize, fileSize);
+
+        // COWNOTE(n2omatt): Searching from (end - 1) keeps the chunk
+        //   untouched when it already ends with a newline.
+        if(split == ChunkSplit::Lines && end < fileSize)
+            end = find_line_end(fd, end - 1, fileSize, filename);
+
+        chunks.push_back({ offset, static_cast<size_t>(end - offset) });
+        offset = end;
+    }
+
+    return chunks;
+}
+
+//------------------------------------------------------------------------------
+// Runs func(chunk, workerIndex) for all chunks using the given number
+// of threads - workerIndex is in [0, threads).
+// The first exception stops the remaining work and is rethrown.
+template <typename Func>
+static void run_parallel(
+    const std::vector<Chunk> &chunks,
+    size_t                    threads,
+    Func                      func)
+{
+    std::atomic<size_t> next_chunk(0);
+    std::atomic<bool>   failed    (false);
+    std::exception_ptr  p_exception;
+    std::mutex          exception_mutex;
+
+    auto worker = [&](size_t workerIndex) {
+        while(!failed.load(std::memory_order_relaxed))
+        {
+            auto index = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if(index >= chunks.size())
+                return;
+
+            try {
+                func(chunks[index], workerIndex);
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if(!p_exception)
+                    p_exception = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    // The calling thread is one of the workers.
+    std::vector<std::thread> workers;
+    for(size_t i = 1; i < threads; ++i)
+        workers.emplace_back(worker, i);
+
+    worker(0);
+    for(auto &thread : workers)
+        thread.join();
+
+    if(p_exception)
+        std::rethrow_exception(p_exception);
+}
+
+
+//----------------------------------------------------------------------------//
+// Parallel Read                                                              //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::vector<byte_t> CoreFile::ParallelRead(
+    const std::string &filename,
+    size_t             chunkSize /* = kParallelReadDefaultChunkSize */,
+    size_t             threads   /* = 0 */)
+{
+    chunkSize = std::max<size_t>(1, chunkSize);
+
+    auto fd   = Private::open_fd(filename, O_RDONLY);
+    auto size = Private::fd_size(fd.Get(), filename);
+
+    std::vector<byte_t> ret_val(size);
+    if(size == 0)
+        return ret_val;
+
+    auto chunks = split_in_chunks(fd.Get(), size, chunkSize, ChunkSplit::Bytes, filename);
+    threads     = resolve_thread_count(threads, chunks.size());
+
+    auto p_data = ret_val.data();
+    run_parallel(chunks, threads, [&](const Chunk &chunk, size_t) {
+        auto n = Private::pread_all(
+            fd.Get(),
+            p_data + chunk.offset,
+            chunk.size,
+            chunk.offset,
+            filename
+        );
+
+        COREASSERT_THROW_IF_NOT(
+            n == chunk.size,
+            std::runtime_error,
+            "File was truncated while reading - filename: (%s)",
+            filename.c_str()
+        );
+    });
+
+    return ret_val;
+}
+
+//------------------------------------------------------------------------------
+void CoreFile::ParallelReadChunks(
+    const std::string   &filename,
+    const ChunkCallback &callback,
+    size_t               chunkSize /* = kParallelReadDefaultChunkSize */,
+    size_t               threads   /* = 0 */,
+    ChunkSplit           split     /* = ChunkSplit::Bytes */)
+{
+    chunkSize = std::max<size_t>(1, chunkSize);
+
+    auto fd   = Private::open_fd(filename, O_RDONLY);
+    auto size = Private::fd_size(fd.Get(), filename);
+    if(size == 0)
+        return;
+
+    auto chunks = split_in_chunks(fd.Get(), size, chunkSize, split, filename);
+    threads     = resolve_thread_count(threads, chunks.size());
+
+    // COWNOTE(n2omatt): One buffer per worker, reused among its chunks.
+    std::vector<std::vector<byte_t>> buffers(threads);
+
+    run_parallel(chunks, threads, [&](const Chunk &chunk, size_t workerIndex) {
+        auto &buffer = buffers[workerIndex];
+        if(buffer.size() < chunk.size)
+            buffer.resize(chunk.size);
+
+        auto n = Private::pread_all(
+            fd.Get(),
+            buffer.data(),
+            chunk.size,
+            chunk.offset,
+            filename
+        );
+
+        callback(chunk.offset, buffer.data(), n);
+    });
+}
@@ -0,0 +1,62 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Async_Engine.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Backends used by AsyncIO.                                               //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <memory>
+// CoreFile
+#include "../../include/AsyncFile.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+///-----------------------------------------------------------------------------
+/// @brief Interface of the AsyncIO backends.
+class AsyncEngine
+{
+public:
+    virtual ~AsyncEngine() {}
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Queues all the operations - Implementations should make them
+    ///   visible to the executor at once.
+    virtual void Submit(const AsyncOperation *pOperations, size_t count) = 0;
+
+    virtual AsyncBackend GetBackend() const = 0;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Creates the io_uring backend.
+/// @returns
+///   nullptr if io_uring isn't available (old kernel, disabled by
+///   seccomp, built without the kernel headers...).
+std::unique_ptr<AsyncEngine> create_io_uring_engine(size_t queueDepth);
+
+///-----------------------------------------------------------------------------
+/// @brief Creates the thread pool backend.
+std::unique_ptr<AsyncEngine> create_thread_pool_engine(size_t threads);
+
+} // namespace Private
+NS_COREFILE_END
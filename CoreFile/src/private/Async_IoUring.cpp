@@ -0,0 +1,559 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Async_IoUring.cpp                                             //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    io_uring backend of AsyncIO.                                            //
+//    It talks directly with the kernel interface (no liburing) so the        //
+//    library doesn't get an extra dependency.                                //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "Async_Engine.h"
+
+// COWNOTE(n2omatt): Only compiled when the kernel headers know about
+//   io_uring - Otherwise the factory returns nullptr and AsyncIO falls
+//   back to the thread pool.
+#if defined(__linux__) && defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #include <linux/io_uring.h>
+        #include <sys/syscall.h>
+        #if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+            #define COREFILE_HAS_IO_URING 1
+        #endif
+    #endif
+#endif
+
+#if !defined(COREFILE_HAS_IO_URING)
+//------------------------------------------------------------------------------
+std::unique_ptr<CoreFile::Private::AsyncEngine>
+CoreFile::Private::create_io_uring_engine(size_t /* queueDepth */)
+{
+    return nullptr;
+}
+
+#else // COREFILE_HAS_IO_URING
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+// POSIX
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params *pParams)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, pParams));
+}
+
+//------------------------------------------------------------------------------
+static int sys_io_uring_enter(
+    int      fd,
+    unsigned toSubmit,
+    unsigned minComplete,
+    unsigned flags)
+{
+    return static_cast<int>(
+        syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0)
+    );
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+static inline T load_acquire(const T *p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+static inline void store_release(T *p, T value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+// An operation in flight - Its address is the sqe user_data.
+struct InFlightOp
+{
+    AsyncOperation op;
+    struct iovec   iov;
+    size_t         done;
+};
+
+// user_data of the NOP used to wake the reaper thread.
+static const uint64_t kWakeUpUserData = 0;
+
+
+//----------------------------------------------------------------------------//
+// IoUringEngine                                                              //
+//----------------------------------------------------------------------------//
+class IoUringEngine :
+    public Private::AsyncEngine
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    IoUringEngine() :
+        m_ringFd    (-1),
+        m_pSqRing   (nullptr),
+        m_pCqRing   (nullptr),
+        m_pSqes     (nullptr),
+        m_sqRingSize(0),
+        m_cqRingSize(0),
+        m_sqesSize  (0),
+        m_pending   (0),
+        m_maxInFlight(0),
+        m_inFlight  (0),
+        m_outstanding(0),
+        m_stopping  (false)
+    {
+        // Empty...
+    }
+
+    ~IoUringEngine()
+    {
+        if(m_reaper.joinable())
+        {
+            // Wait all the operations (the overflowed ones too) and then
+            // wake the reaper to exit.
+            {
+                std::unique_lock<std::mutex> lock(m_submitMutex);
+                m_idleCond.wait(lock, [this]() { return m_outstanding == 0; });
+            }
+
+            // COWNOTE(n2omatt): If the NOP can't be sent the reaper's
+            //   io_uring_enter fails as well and it sees m_stopping.
+            m_stopping = true;
+            {
+                std::lock_guard<std::mutex> lock(m_submitMutex);
+                auto p_sqe = NextSqe();
+                p_sqe->opcode    = IORING_OP_NOP;
+                p_sqe->user_data = kWakeUpUserData;
+                Flush();
+            }
+            m_reaper.join();
+        }
+
+        if(m_pSqes)                            munmap(m_pSqes,   m_sqesSize  );
+        if(m_pCqRing && m_pCqRing != m_pSqRing) munmap(m_pCqRing, m_cqRingSize);
+        if(m_pSqRing)                          munmap(m_pSqRing, m_sqRingSize);
+        if(m_ringFd != -1)                     close(m_ringFd);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Init                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    bool Init(size_t queueDepth)
+    {
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+
+        m_ringFd = sys_io_uring_setup(
+            static_cast<unsigned>(std::max<size_t>(queueDepth, 1)),
+            &params
+        );
+        if(m_ringFd < 0)
+        {
+            m_ringFd = -1;
+            return false;
+        }
+
+        //----------------------------------------------------------------------
+        // Map the rings.
+        m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cqRingSize = params.cq_off.cqes  + params.cq_entries * sizeof(struct io_uring_cqe);
+
+        auto single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if(single_mmap)
+            m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+
+        m_pSqRing = Map(m_sqRingSize, IORING_OFF_SQ_RING);
+        if(!m_pSqRing)
+            return false;
+
+        m_pCqRing = (single_mmap) ? m_pSqRing : Map(m_cqRingSize, IORING_OFF_CQ_RING);
+        if(!m_pCqRing)
+            return false;
+
+        m_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+        m_pSqes    = static_cast<struct io_uring_sqe *>(Map(m_sqesSize, IORING_OFF_SQES));
+        if(!m_pSqes)
+            return false;
+
+        auto p_sq = static_cast<char *>(m_pSqRing);
+        m_pSqHead  = reinterpret_cast<unsigned *>(p_sq + params.sq_off.head        );
+        m_pSqTail  = reinterpret_cast<unsigned *>(p_sq + params.sq_off.tail        );
+        m_sqMask   = *reinterpret_cast<unsigned *>(p_sq + params.sq_off.ring_mask  );
+        m_sqCount  = *reinterpret_cast<unsigned *>(p_sq + params.sq_off.ring_entries);
+        m_pSqArray = reinterpret_cast<unsigned *>(p_sq + params.sq_off.array       );
+
+        auto p_cq = static_cast<char *>(m_pCqRing);
+        m_pCqHead = reinterpret_cast<unsigned *>(p_cq + params.cq_off.head      );
+        m_pCqTail = reinterpret_cast<unsigned *>(p_cq + params.cq_off.tail      );
+        m_cqMask  = *reinterpret_cast<unsigned *>(p_cq + params.cq_off.ring_mask);
+        m_pCqes   = reinterpret_cast<struct io_uring_cqe *>(p_cq + params.cq_off.cqes);
+
+        // COWNOTE(n2omatt): Never have more operations in flight than the
+        //   completion queue can hold, so no completion is ever dropped.
+        //   One slot is kept for the wake up NOP.
+        m_maxInFlight = std::max<size_t>(1, params.cq_entries - 1);
+
+        m_reaper = std::thread(&IoUringEngine::ReaperLoop, this);
+        return true;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // AsyncEngine Interface                                                  //
+    //------------------------------------------------------------------------//
+public:
+    void Submit(const AsyncOperation *pOperations, size_t count) override
+    {
+        // COWNOTE(n2omatt): Never blocks - Callbacks run on the reaper
+        //   and may submit more operations, waiting for a free slot there
+        //   would wait for the reaper itself. Operations that don't fit in
+        //   the queue wait in m_overflow and are sent as slots are freed.
+        {
+            std::lock_guard<std::mutex> lock(m_submitMutex);
+            for(size_t i = 0; i < count; ++i)
+            {
+                auto p_op  = new InFlightOp();
+                p_op->op   = pOperations[i];
+                p_op->done = 0;
+
+                ++m_outstanding;
+                if(m_inFlight < m_maxInFlight)
+                {
+                    ++m_inFlight;
+                    Queue(p_op);
+                }
+                else
+                {
+                    m_overflow.push_back(p_op);
+                }
+            }
+            Flush();
+        }
+
+        CompleteFailed();
+    }
+
+    AsyncBackend GetBackend() const override
+    {
+        return AsyncBackend::IoUring;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void* Map(size_t size, off_t offset)
+    {
+        auto p_addr = mmap(
+            nullptr, size,
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, offset
+        );
+
+        return (p_addr == MAP_FAILED) ? nullptr : p_addr;
+    }
+
+    //--------------------------------------------------------------------------
+    // Must be called with m_submitMutex held.
+    struct io_uring_sqe* NextSqe()
+    {
+        auto tail = *m_pSqTail;
+        if(tail - load_acquire(m_pSqHead) == m_sqCount)
+        {
+            Flush();
+            tail = *m_pSqTail;
+        }
+
+        auto index  = tail & m_sqMask;
+        auto p_sqe  = &m_pSqes[index];
+        memset(p_sqe, 0, sizeof(*p_sqe));
+
+        m_pSqArray[index] = index;
+        store_release(m_pSqTail, tail + 1);
+        ++m_pending;
+
+        return p_sqe;
+    }
+
+    //--------------------------------------------------------------------------
+    // Must be called with m_submitMutex held.
+    void Queue(InFlightOp *pOp)
+    {
+        auto &op = pOp->op;
+        pOp->iov.iov_base = static_cast<char *>(op.pBuffer) + pOp->done;
+        pOp->iov.iov_len  = op.size - pOp->done;
+
+        auto p_sqe = NextSqe();
+        p_sqe->opcode    = (op.type == AsyncOperation::Type::Read)
+            ? IORING_OP_READV
+            : IORING_OP_WRITEV;
+        p_sqe->fd        = op.fd;
+        p_sqe->addr      = reinterpret_cast<uint64_t>(&pOp->iov);
+        p_sqe->len       = 1;
+        p_sqe->off       = op.offset + pOp->done;
+        p_sqe->user_data = reinterpret_cast<uint64_t>(pOp);
+    }
+
+    //--------------------------------------------------------------------------
+    // Sends all the queued sqes to the kernel with io_uring_enter(2).
+    // Must be called with m_submitMutex held.
+    void Flush()
+    {
+        while(m_pending > 0)
+        {
+            auto n = sys_io_uring_enter(m_ringFd, m_pending, 0, 0);
+            if(n < 0)
+            {
+                if(errno == EINTR || errno == EAGAIN || errno == EBUSY)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                DropPending(errno);
+                return;
+            }
+
+            m_pending -= std::min<unsigned>(m_pending, static_cast<unsigned>(n));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Takes back the sqes that the kernel refused and moves their
+    // operations to m_failed - Otherwise they'd never complete.
+    // Must be called with m_submitMutex held.
+    void DropPending(int error)
+    {
+        auto head = load_acquire(m_pSqHead);
+        auto tail = *m_pSqTail;
+
+        for(auto i = head; i != tail; ++i)
+        {
+            auto user_data = m_pSqes[m_pSqArray[i & m_sqMask]].user_data;
+            if(user_data != kWakeUpUserData)
+            {
+                auto p_op = reinterpret_cast<InFlightOp *>(user_data);
+                m_failed.push_back(std::make_pair(p_op, error));
+            }
+        }
+
+        store_release(m_pSqTail, head);
+        m_pending = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // Moves the overflowed operations into the freed slots.
+    // Must be called with m_submitMutex held.
+    void QueueOverflow()
+    {
+        if(m_overflow.empty())
+            return;
+
+        while(!m_overflow.empty() && m_inFlight < m_maxInFlight)
+        {
+            ++m_inFlight;
+            Queue(m_overflow.front());
+            m_overflow.pop_front();
+        }
+        Flush();
+    }
+
+    //--------------------------------------------------------------------------
+    void ReaperLoop()
+    {
+        while(true)
+        {
+            auto head = *m_pCqHead;
+            auto tail = load_acquire(m_pCqTail);
+
+            if(head == tail)
+            {
+                if(m_stopping)
+                    return;
+
+                sys_io_uring_enter(m_ringFd, 0, 1, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+
+            // COWNOTE(n2omatt): Each cqe is consumed before its
+            //   operation completes - The slot is given to another
+            //   operation right away and its completion needs the room.
+            while(head != tail)
+            {
+                auto user_data = m_pCqes[head & m_cqMask].user_data;
+                auto result    = m_pCqes[head & m_cqMask].res;
+                store_release(m_pCqHead, ++head);
+
+                if(user_data != kWakeUpUserData)
+                    Complete(reinterpret_cast<InFlightOp *>(user_data), result);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void Complete(InFlightOp *pOp, int result)
+    {
+        // COWNOTE(n2omatt): Short transfers are resubmitted so the
+        //   semantics match the thread pool backend - Only EOF ends an
+        //   operation early.
+        if(result > 0)
+        {
+            pOp->done += result;
+            if(pOp->done < pOp->op.size)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_submitMutex);
+                    Queue(pOp);
+                    Flush();
+                }
+                CompleteFailed();
+                return;
+            }
+        }
+
+        Finish(pOp, (result < 0) ? -result : 0);
+        CompleteFailed();
+    }
+
+    //--------------------------------------------------------------------------
+    void Finish(InFlightOp *pOp, int error)
+    {
+        // The slot is released before the callback, so a callback that
+        // submits finds it free.
+        {
+            std::lock_guard<std::mutex> lock(m_submitMutex);
+            --m_inFlight;
+            QueueOverflow();
+        }
+
+        if(pOp->op.callback)
+            pOp->op.callback(error, pOp->done);
+        delete pOp;
+
+        {
+            std::lock_guard<std::mutex> lock(m_submitMutex);
+            --m_outstanding;
+        }
+        m_idleCond.notify_all();
+    }
+
+    //--------------------------------------------------------------------------
+    // Completes the operations that io_uring_enter refused - Never called
+    // with m_submitMutex held since the callbacks may submit.
+    void CompleteFailed()
+    {
+        while(true)
+        {
+            std::vector<std::pair<InFlightOp *, int>> failed;
+            {
+                std::lock_guard<std::mutex> lock(m_submitMutex);
+                failed.swap(m_failed);
+            }
+            if(failed.empty())
+                return;
+
+            for(auto &entry : failed)
+                Finish(entry.first, entry.second);
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // Ring.
+    int                  m_ringFd;
+    void                *m_pSqRing;
+    void                *m_pCqRing;
+    struct io_uring_sqe *m_pSqes;
+    size_t               m_sqRingSize;
+    size_t               m_cqRingSize;
+    size_t               m_sqesSize;
+
+    unsigned            *m_pSqHead;
+    unsigned            *m_pSqTail;
+    unsigned            *m_pSqArray;
+    unsigned             m_sqMask;
+    unsigned             m_sqCount;
+
+    unsigned            *m_pCqHead;
+    unsigned            *m_pCqTail;
+    struct io_uring_cqe *m_pCqes;
+    unsigned             m_cqMask;
+
+    // Submission.
+    std::mutex           m_submitMutex;
+    unsigned             m_pending;
+
+    // Flow control - Guarded by m_submitMutex.
+    size_t                                    m_maxInFlight;
+    size_t                                    m_inFlight;
+    size_t                                    m_outstanding;
+    std::deque<InFlightOp *>                  m_overflow;
+    std::vector<std::pair<InFlightOp *, int>> m_failed;
+    std::condition_variable                   m_idleCond;
+
+    // Completion.
+    std::thread          m_reaper;
+    std::atomic<bool>    m_stopping;
+};
+
+
+//----------------------------------------------------------------------------//
+// Factory                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::unique_ptr<Private::AsyncEngine>
+CoreFile::Private::create_io_uring_engine(size_t queueDepth)
+{
+    std::unique_ptr<IoUringEngine> p_engine(new IoUringEngine());
+    if(!p_engine->Init(queueDepth))
+        return nullptr;
+
+    return std::unique_ptr<Private::AsyncEngine>(p_engine.release());
+}
+
+#endif // COREFILE_HAS_IO_URING
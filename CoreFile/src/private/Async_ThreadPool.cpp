@@ -0,0 +1,176 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Async_ThreadPool.cpp                                          //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "Async_Engine.h"
+// std
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+// POSIX
+#include <unistd.h>
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Performs the whole operation handling short transfers and EINTR.
+// Returns the errno value, 0 on success.
+static int perform(const AsyncOperation &op, size_t &done)
+{
+    auto p_data = static_cast<char *>(op.pBuffer);
+    done = 0;
+
+    while(done < op.size)
+    {
+        auto n = (op.type == AsyncOperation::Type::Read)
+            ? pread (op.fd, p_data + done, op.size - done, op.offset + done)
+            : pwrite(op.fd, p_data + done, op.size - done, op.offset + done);
+
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n < 0)
+            return errno;
+        if(n == 0)
+            break;
+
+        done += n;
+    }
+
+    return 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// ThreadPoolEngine                                                           //
+//----------------------------------------------------------------------------//
+class ThreadPoolEngine :
+    public Private::AsyncEngine
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit ThreadPoolEngine(size_t threads) :
+        m_stopping(false)
+    {
+        if(threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        for(size_t i = 0; i < threads; ++i)
+            m_threads.emplace_back(&ThreadPoolEngine::WorkerLoop, this);
+    }
+
+    ~ThreadPoolEngine()
+    {
+        // Workers drain the queue before leaving.
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_cond.notify_all();
+
+        for(auto &thread : m_threads)
+            thread.join();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // AsyncEngine Interface                                                  //
+    //------------------------------------------------------------------------//
+public:
+    void Submit(const AsyncOperation *pOperations, size_t count) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.insert(m_queue.end(), pOperations, pOperations + count);
+        }
+
+        if(count == 1)
+            m_cond.notify_one();
+        else
+            m_cond.notify_all();
+    }
+
+    AsyncBackend GetBackend() const override
+    {
+        return AsyncBackend::ThreadPool;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void WorkerLoop()
+    {
+        while(true)
+        {
+            AsyncOperation op;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cond.wait(lock, [this]() {
+                    return m_stopping || !m_queue.empty();
+                });
+
+                if(m_queue.empty())
+                    return;
+
+                op = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+
+            size_t done  = 0;
+            auto   error = perform(op, done);
+
+            if(op.callback)
+                op.callback(error, done);
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::mutex                 m_mutex;
+    std::condition_variable    m_cond;
+    std::deque<AsyncOperation> m_queue;
+    std::vector<std::thread>   m_threads;
+    bool                       m_stopping;
+};
+
+
+//----------------------------------------------------------------------------//
+// Factory                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+std::unique_ptr<Private::AsyncEngine>
+CoreFile::Private::create_thread_pool_engine(size_t threads)
+{
+    return std::unique_ptr<AsyncEngine>(new ThreadPoolEngine(threads));
+}
@@ -0,0 +1,233 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Copy_Engine.cpp                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "Copy_Engine.h"
+// std
+#include <algorithm>
+#include <vector>
+// POSIX
+#if defined(__linux__)
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+    #include <sys/sendfile.h>
+#endif
+// CoreFile
+#include "Posix_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Max bytes moved by each copy_file_range(2) / sendfile(2) call.
+static const size_t kKernelChunkSize = 1 << 30;
+// Size of the user space buffer of the fallback loop.
+static const size_t kBufferSize      = 1 << 20;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): Errors that means "this strategy isn't supported
+//   for these descriptors" - We should fallback instead of failing.
+static bool is_unsupported_error(int err)
+{
+    return err == ENOSYS
+        || err == EXDEV
+        || err == EINVAL
+        || err == EOPNOTSUPP
+        || err == ENOTTY
+        || err == EBADF;
+}
+
+//------------------------------------------------------------------------------
+// COWNOTE(n2omatt): Some files (i.e. /proc, /sys) report size 0 and the
+//   in kernel copies return 0 right away for them - Same of the reads
+//   in read_whole_file, those must fallback to read(2) until EOF.
+static bool is_unknown_size_file(size_t srcSize, size_t copied)
+{
+    return srcSize == 0 && copied == 0;
+}
+
+//------------------------------------------------------------------------------
+static void throw_copy_error(const std::string &src, const std::string &dst)
+{
+    COREASSERT_THROW_IF_NOT(
+        false,
+        std::runtime_error,
+        "Failed to copy file - src: (%s) - dst: (%s) - error: (%s)",
+        src.c_str(),
+        dst.c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+static bool try_reflink(int srcFd, int dstFd)
+{
+#if defined(__linux__) && defined(FICLONE)
+    COREFILE_COUNT_SYSCALL();
+    return ioctl(dstFd, FICLONE, srcFd) == 0;
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Returns false if the strategy isn't supported (or can't tell the size
+// of the file) and nothing was copied.
+static bool try_copy_file_range(
+    int                srcFd,
+    int                dstFd,
+    size_t             srcSize,
+    size_t            &copied,
+    const std::string &src,
+    const std::string &dst)
+{
+#if defined(__linux__) && defined(__GLIBC__) \
+    && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+    while(true)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = copy_file_range(
+            srcFd, nullptr, dstFd, nullptr, kKernelChunkSize, 0
+        );
+
+        if(n > 0) { copied += n; continue; }
+        if(n == 0) return !is_unknown_size_file(srcSize, copied);
+        if(errno == EINTR) continue;
+
+        if(copied == 0 && is_unsupported_error(errno))
+            return false;
+
+        throw_copy_error(src, dst);
+    }
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Returns false if the strategy isn't supported (or can't tell the size
+// of the file) and nothing was copied.
+static bool try_sendfile(
+    int                srcFd,
+    int                dstFd,
+    size_t             srcSize,
+    size_t            &copied,
+    const std::string &src,
+    const std::string &dst)
+{
+#if defined(__linux__)
+    while(true)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = sendfile(dstFd, srcFd, nullptr, kKernelChunkSize);
+
+        if(n > 0) { copied += n; continue; }
+        if(n == 0) return !is_unknown_size_file(srcSize, copied);
+        if(errno == EINTR) continue;
+
+        if(copied == 0 && is_unsupported_error(errno))
+            return false;
+
+        throw_copy_error(src, dst);
+    }
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+static void buffered_copy(
+    int                srcFd,
+    int                dstFd,
+    size_t             srcSize,
+    size_t            &copied,
+    const std::string &src,
+    const std::string &dst)
+{
+    // Small files doesn't need the whole buffer.
+    std::vector<char> buffer(std::max<size_t>(1, std::min(srcSize, kBufferSize)));
+
+    while(true)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = read(srcFd, buffer.data(), buffer.size());
+        if(n == 0)
+            return;
+        if(n < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            throw_copy_error(src, dst);
+        }
+
+        // Handle short writes.
+        auto p_data = buffer.data();
+        while(n > 0)
+        {
+            COREFILE_COUNT_SYSCALL();
+            auto w = write(dstFd, p_data, n);
+            if(w < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+                throw_copy_error(src, dst);
+            }
+
+            p_data += w;
+            n      -= w;
+            copied += w;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t CoreFile::Private::copy_fd(
+    int                srcFd,
+    int                dstFd,
+    size_t             srcSize,
+    const std::string &src,
+    const std::string &dst)
+{
+    if(srcSize != 0 && try_reflink(srcFd, dstFd))
+        return srcSize;
+
+#if defined(POSIX_FADV_SEQUENTIAL)
+    posix_fadvise(srcFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    size_t copied = 0;
+    if(try_copy_file_range(srcFd, dstFd, srcSize, copied, src, dst))
+        return copied;
+    if(try_sendfile(srcFd, dstFd, srcSize, copied, src, dst))
+        return copied;
+
+    buffered_copy(srcFd, dstFd, srcSize, copied, src, dst);
+    return copied;
+}
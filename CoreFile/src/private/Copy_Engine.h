@@ -0,0 +1,63 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Copy_Engine.h                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streaming fd to fd copy used by CoreFile::Copy.                         //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+// CoreFile
+#include "../../include/CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Copies the whole contents of srcFd into dstFd without ever holding
+///   more than a fixed size buffer in user memory.
+///   The strategies are tried in order, falling back to the next one
+///   when the kernel / filesystem doesn't support it:
+///     1 - Reflink (FICLONE)    - Shares the extents, no data is copied.
+///     2 - copy_file_range(2)   - In kernel copy (may be offloaded).
+///     3 - sendfile(2)          - In kernel copy.
+///     4 - read(2) / write(2)   - Fixed size buffered loop.
+/// @param srcFd
+///   Source descriptor - Must be positioned at the beginning.
+/// @param dstFd
+///   Destination descriptor - Must be empty and positioned at the beginning.
+/// @param srcSize
+///   The size of the source - Used as a hint only.
+/// @param src / dst
+///   Filenames - Only used for error messages.
+/// @returns
+///   The number of bytes copied.
+/// @throws std::runtime_error on I/O errors.
+size_t copy_fd(
+    int                srcFd,
+    int                dstFd,
+    size_t             srcSize,
+    const std::string &src,
+    const std::string &dst);
+
+} // namespace Private
+NS_COREFILE_END
@@ -0,0 +1,88 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Instrumentation_Scope.h                                       //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Macros that record the instrumented operations - They expand to         //
+//    nothing unless COREFILE_INSTRUMENTATION is set.                         //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// CoreFile
+#include "../../include/Config.h"
+#include "../../include/CoreFile_Utils.h"
+#include "../../include/Instrumentation.h"
+
+
+#if COREFILE_INSTRUMENTATION
+
+// std
+#include <chrono>
+#include <cstdint>
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+// Syscalls made and bytes transferred by the calling thread - Only
+// ever grow, the scopes record the difference.
+extern thread_local uint64_t t_syscallCount;
+extern thread_local uint64_t t_byteCount;
+
+//------------------------------------------------------------------------------
+// Records the duration (and whether it threw) of an operation in the
+// slot of the calling thread.
+// COWNOTE(n2omatt): Operations call each other (AppendAllLines calls
+//   AppendAllText...) so only the outermost scope of the thread records.
+class OperationScope
+{
+public:
+    explicit OperationScope(IoOperation operation);
+    ~OperationScope();
+
+    OperationScope(const OperationScope &)            = delete;
+    OperationScope& operator =(const OperationScope &) = delete;
+
+private:
+    IoOperation                           m_operation;
+    bool                                  m_outermost;
+    int                                   m_uncaughtExceptions;
+    uint64_t                              m_startBytes;
+    uint64_t                              m_startSyscalls;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace Private
+NS_COREFILE_END
+
+
+#define COREFILE_INSTRUMENT(_operation_) \
+    CoreFile::Private::OperationScope corefile_operation_scope(_operation_)
+
+#define COREFILE_INSTRUMENT_BYTES(_bytes_) \
+    (CoreFile::Private::t_byteCount += (_bytes_))
+
+#define COREFILE_COUNT_SYSCALL() \
+    (++CoreFile::Private::t_syscallCount)
+
+#else // COREFILE_INSTRUMENTATION
+
+#define COREFILE_INSTRUMENT(_operation_)   do {} while(0)
+#define COREFILE_INSTRUMENT_BYTES(_bytes_) do { (void)sizeof(_bytes_); } while(0)
+#define COREFILE_COUNT_SYSCALL()           do {} while(0)
+
+#endif // COREFILE_INSTRUMENTATION
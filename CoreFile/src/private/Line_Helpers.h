@@ -0,0 +1,85 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Line_Helpers.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Private helpers that split a text into lines and join the lines back    //
+//    into a text - Shared by the plain and the compressed *AllLines.         //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <string>
+#include <vector>
+// CoreFile
+#include "../../include/CoreFile_Utils.h"
+// CoreFS
+#include "CoreFS/CoreFS.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+//------------------------------------------------------------------------------
+// Splits the contents at every '\n'.
+// COWNOTE(n2omatt): This keeps the behavior of the previous std::getline
+//   loop of ReadAllLines: N newlines always gives N + 1 lines (so an
+//   empty file has one empty line).
+inline std::vector<std::string> split_lines(const std::string &contents)
+{
+    std::vector<std::string> lines;
+
+    auto beg = size_t(0);
+    while(true)
+    {
+        auto end = contents.find('\n', beg);
+        if(end == std::string::npos)
+        {
+            lines.emplace_back(contents, beg, std::string::npos);
+            break;
+        }
+
+        lines.emplace_back(contents, beg, end - beg);
+        beg = end + 1;
+    }
+
+    return lines;
+}
+
+//------------------------------------------------------------------------------
+// Joins the lines into a single string, each one followed by the
+// platform new line - Sized upfront so there's a single allocation.
+inline std::string join_lines(const std::vector<std::string> &lines)
+{
+    auto new_line = CoreFS::NewLine();
+    auto size     = size_t(0);
+    for(const auto &line : lines)
+        size += line.size() + new_line.size();
+
+    std::string contents;
+    contents.reserve(size);
+    for(const auto &line : lines)
+    {
+        contents.append(line);
+        contents.append(new_line);
+    }
+
+    return contents;
+}
+
+} // namespace Private
+NS_COREFILE_END
@@ -0,0 +1,363 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Lz4_Codec.cpp                                                 //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "Lz4_Codec.h"
+// std
+#include <cstring>
+#include <vector>
+// CoreFile
+#include "../../include/Endian.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// From the LZ4 block format - The last 5 bytes are always literals and
+// the last match starts at least 12 bytes before the end.
+static const size_t kMinMatch     = 4;
+static const size_t kLastLiterals = 5;
+static const size_t kMfLimit      = 12;
+static const size_t kMaxOffset    = 65535;
+static const size_t kRunMask      = 15;
+
+static const int kHashLog = 16;
+
+static const uint32_t kPrime1 = 2654435761u;
+static const uint32_t kPrime2 = 2246822519u;
+static const uint32_t kPrime3 = 3266489917u;
+static const uint32_t kPrime4 =  668265263u;
+static const uint32_t kPrime5 =  374761393u;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static uint32_t read_u32_le(const void *pData)
+{
+    uint32_t value;
+    memcpy(&value, pData, sizeof(value));
+    return ConvertEndian<Endian::Little>(value);
+}
+
+//------------------------------------------------------------------------------
+static uint32_t rotl32(uint32_t value, int bits)
+{
+    return (value << bits) | (value >> (32 - bits));
+}
+
+//------------------------------------------------------------------------------
+static uint32_t hash_sequence(uint32_t sequence)
+{
+    return (sequence * kPrime1) >> (32 - kHashLog);
+}
+
+//------------------------------------------------------------------------------
+// Writes the 15 + N * 255 + rest tail of a length - Returns nullptr if
+// it doesn't fit.
+static char* write_length(char *pOut, const char *pEnd, size_t length)
+{
+    for(; length >= 255; length -= 255)
+    {
+        if(pOut == pEnd)
+            return nullptr;
+        *pOut++ = char(255);
+    }
+
+    if(pOut == pEnd)
+        return nullptr;
+    *pOut++ = char(length);
+
+    return pOut;
+}
+
+//------------------------------------------------------------------------------
+// Writes a sequence: token, literals and (unless it's the last one)
+// the match - Returns nullptr if it doesn't fit.
+static char* write_sequence(
+    char       *pOut,
+    const char *pEnd,
+    const char *pLiterals,
+    size_t      literalCount,
+    size_t      offset,
+    size_t      matchLength)
+{
+    if(pOut == pEnd)
+        return nullptr;
+
+    auto p_token = pOut++;
+    auto token   = (literalCount >= kRunMask) ? kRunMask : literalCount;
+
+    if(literalCount >= kRunMask)
+    {
+        pOut = write_length(pOut, pEnd, literalCount - kRunMask);
+        if(!pOut)
+            return nullptr;
+    }
+
+    if(size_t(pEnd - pOut) < literalCount)
+        return nullptr;
+    memcpy(pOut, pLiterals, literalCount);
+    pOut += literalCount;
+
+    // Last sequence - Literals only.
+    if(matchLength == 0)
+    {
+        *p_token = char(token << 4);
+        return pOut;
+    }
+
+    if(pEnd - pOut < 2)
+        return nullptr;
+    *pOut++ = char(offset & 0xFF);
+    *pOut++ = char(offset >> 8);
+
+    auto match_code = matchLength - kMinMatch;
+    *p_token = char((token << 4) | ((match_code >= kRunMask) ? kRunMask : match_code));
+
+    if(match_code >= kRunMask)
+        pOut = write_length(pOut, pEnd, match_code - kRunMask);
+
+    return pOut;
+}
+
+//------------------------------------------------------------------------------
+// Reads the 15 + N * 255 + rest tail of a length - Returns false if
+// the input ends before it.
+static bool read_length(const char *pSrc, size_t size, size_t &ip, size_t &length)
+{
+    while(true)
+    {
+        if(ip >= size)
+            return false;
+
+        auto value = uint8_t(pSrc[ip++]);
+        length += value;
+        if(value != 255)
+            return true;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Block                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t Private::lz4_compress_block(
+    const char *pSrc,
+    size_t      size,
+    char       *pDst,
+    size_t      capacity)
+{
+    auto p_out = pDst;
+    auto p_end = pDst + capacity;
+
+    // COWNOTE(n2omatt): Greedy parsing with a single entry hash table,
+    //   the same idea of LZ4_compress_fast - Fast and good enough for
+    //   logs, which is what this is used for.
+    auto anchor = size_t(0);
+    if(size > kMfLimit)
+    {
+        std::vector<uint32_t> table(size_t(1) << kHashLog, 0);
+
+        auto match_limit = size - kLastLiterals;
+        auto ip          = size_t(1);
+        table[hash_sequence(read_u32_le(pSrc))] = 0;
+
+        while(ip + kMfLimit <= size)
+        {
+            auto sequence  = read_u32_le(pSrc + ip);
+            auto &entry    = table[hash_sequence(sequence)];
+            auto candidate = size_t(entry);
+            entry = uint32_t(ip);
+
+            if(ip - candidate > kMaxOffset
+            || read_u32_le(pSrc + candidate) != sequence)
+            {
+                // Skip faster the longer nothing matches.
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            // Extend backwards into the pending literals...
+            while(ip > anchor && candidate > 0 && pSrc[ip - 1] == pSrc[candidate - 1])
+            {
+                --ip;
+                --candidate;
+            }
+
+            // ...and forward up to the last literals.
+            auto length = kMinMatch;
+            while(ip + length < match_limit && pSrc[candidate + length] == pSrc[ip + length])
+                ++length;
+
+            p_out = write_sequence(
+                p_out,
+                p_end,
+                pSrc + anchor,
+                ip - anchor,
+                ip - candidate,
+                length
+            );
+            if(!p_out)
+                return 0;
+
+            ip    += length;
+            anchor = ip;
+
+            // Keep the table warm with a position inside the match.
+            if(ip + kMfLimit <= size)
+                table[hash_sequence(read_u32_le(pSrc + ip - 2))] = uint32_t(ip - 2);
+        }
+    }
+
+    p_out = write_sequence(p_out, p_end, pSrc + anchor, size - anchor, 0, 0);
+    if(!p_out)
+        return 0;
+
+    return p_out - pDst;
+}
+
+//------------------------------------------------------------------------------
+size_t Private::lz4_decompress_block(
+    const char *pSrc,
+    size_t      size,
+    char       *pBase,
+    size_t      pos,
+    size_t      capacity)
+{
+    auto ip = size_t(0);
+    auto op = pos;
+
+    while(true)
+    {
+        if(ip >= size)
+            return SIZE_MAX;
+
+        auto token = uint8_t(pSrc[ip++]);
+
+        auto literal_count = size_t(token >> 4);
+        if(literal_count == kRunMask && !read_length(pSrc, size, ip, literal_count))
+            return SIZE_MAX;
+
+        if(literal_count > size - ip || literal_count > capacity - op)
+            return SIZE_MAX;
+
+        memcpy(pBase + op, pSrc + ip, literal_count);
+        ip += literal_count;
+        op += literal_count;
+
+        // The last sequence has only literals.
+        if(ip == size)
+            break;
+
+        if(size - ip < 2)
+            return SIZE_MAX;
+
+        auto offset = size_t(uint8_t(pSrc[ip])) | (size_t(uint8_t(pSrc[ip + 1])) << 8);
+        ip += 2;
+        if(offset == 0 || offset > op)
+            return SIZE_MAX;
+
+        auto length = size_t(token & kRunMask);
+        if(length == kRunMask && !read_length(pSrc, size, ip, length))
+            return SIZE_MAX;
+
+        length += kMinMatch;
+        if(length > capacity - op)
+            return SIZE_MAX;
+
+        // Overlapping matches repeat the last offset bytes (RLE), so
+        // those are copied forward one byte at a time.
+        auto p_match = pBase + op - offset;
+        auto p_out   = pBase + op;
+        if(offset >= length)
+        {
+            memcpy(p_out, p_match, length);
+        }
+        else
+        {
+            for(size_t i = 0; i < length; ++i)
+                p_out[i] = p_match[i];
+        }
+
+        op += length;
+    }
+
+    return op - pos;
+}
+
+
+//----------------------------------------------------------------------------//
+// xxHash32                                                                   //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+uint32_t Private::xxh32(const void *pData, size_t size, uint32_t seed)
+{
+    auto p_curr = static_cast<const uint8_t *>(pData);
+    auto p_end  = p_curr + size;
+
+    uint32_t hash;
+    if(size >= 16)
+    {
+        uint32_t v1 = seed + kPrime1 + kPrime2;
+        uint32_t v2 = seed + kPrime2;
+        uint32_t v3 = seed;
+        uint32_t v4 = seed - kPrime1;
+
+        auto xxh_round = [](uint32_t acc, uint32_t input) {
+            return rotl32(acc + input * kPrime2, 13) * kPrime1;
+        };
+
+        for(; p_end - p_curr >= 16; p_curr += 16)
+        {
+            v1 = xxh_round(v1, read_u32_le(p_curr +  0));
+            v2 = xxh_round(v2, read_u32_le(p_curr +  4));
+            v3 = xxh_round(v3, read_u32_le(p_curr +  8));
+            v4 = xxh_round(v4, read_u32_le(p_curr + 12));
+        }
+
+        hash = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+    }
+    else
+    {
+        hash = seed + kPrime5;
+    }
+
+    hash += uint32_t(size);
+
+    for(; p_end - p_curr >= 4; p_curr += 4)
+        hash = rotl32(hash + read_u32_le(p_curr) * kPrime3, 17) * kPrime4;
+
+    for(; p_curr < p_end; ++p_curr)
+        hash = rotl32(hash + (*p_curr) * kPrime5, 11) * kPrime1;
+
+    hash ^= hash >> 15;
+    hash *= kPrime2;
+    hash ^= hash >> 13;
+    hash *= kPrime3;
+    hash ^= hash >> 16;
+
+    return hash;
+}
@@ -0,0 +1,66 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Lz4_Codec.h                                                   //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    LZ4 block codec and xxHash32 used by the LZ4 frames of Compression.     //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+// CoreFile
+#include "../../include/CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Compresses [pSrc, pSrc + size) as a single independent LZ4 block.
+/// @returns
+///   The compressed size - 0 if it doesn't fit in capacity, so passing
+///   size as the capacity tells if compressing is worth it.
+size_t lz4_compress_block(
+    const char *pSrc,
+    size_t      size,
+    char       *pDst,
+    size_t      capacity);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Decompresses a LZ4 block into pBase + pos - Matches may reference
+///   anything in [pBase, pBase + pos), so linked blocks decode as long
+///   as the previous ones are right before it.
+/// @returns
+///   The decompressed size - Or SIZE_MAX if the block is corrupted or
+///   doesn't fit in [pos, capacity).
+size_t lz4_decompress_block(
+    const char *pSrc,
+    size_t      size,
+    char       *pBase,
+    size_t      pos,
+    size_t      capacity);
+
+///-----------------------------------------------------------------------------
+/// @brief xxHash32 of [pData, pData + size).
+uint32_t xxh32(const void *pData, size_t size, uint32_t seed);
+
+} // namespace Private
+NS_COREFILE_END
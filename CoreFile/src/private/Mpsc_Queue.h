@@ -0,0 +1,129 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Mpsc_Queue.h                                                  //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Intrusive lock-free multiple producer / single consumer queue           //
+//    (Dmitry Vyukov's algorithm). Push is wait-free, a single exchange.     //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <atomic>
+// CoreFile
+#include "../../include/CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+///-----------------------------------------------------------------------------
+/// @brief Base of the queue nodes - Users derive from it.
+struct MpscNode
+{
+    std::atomic<MpscNode *> next;
+
+    MpscNode() : next(nullptr) {}
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The queue doesn't own the nodes - Push transfers them to the
+///   consumer and Pop gives them back.
+class MpscQueue
+{
+public:
+    MpscQueue() :
+        m_head(&m_stub),
+        m_pTail(&m_stub)
+    {
+        // Empty...
+    }
+
+    MpscQueue(const MpscQueue &)            = delete;
+    MpscQueue& operator =(const MpscQueue &) = delete;
+
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Can be called by any number of threads.
+    void Push(MpscNode *pNode)
+    {
+        pNode->next.store(nullptr, std::memory_order_relaxed);
+        auto p_prev = m_head.exchange(pNode, std::memory_order_acq_rel);
+        p_prev->next.store(pNode, std::memory_order_release);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Consumer only.
+    /// @returns
+    ///   nullptr if the queue is empty or if the next node is still being
+    ///   linked by a producer - In that case just try again later.
+    MpscNode* Pop()
+    {
+        auto p_tail = m_pTail;
+        auto p_next = p_tail->next.load(std::memory_order_acquire);
+
+        if(p_tail == &m_stub)
+        {
+            if(!p_next)
+                return nullptr;
+
+            m_pTail = p_next;
+            p_tail  = p_next;
+            p_next  = p_next->next.load(std::memory_order_acquire);
+        }
+
+        if(p_next)
+        {
+            m_pTail = p_next;
+            return p_tail;
+        }
+
+        if(p_tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        Push(&m_stub);
+
+        p_next = p_tail->next.load(std::memory_order_acquire);
+        if(p_next)
+        {
+            m_pTail = p_next;
+            return p_tail;
+        }
+
+        return nullptr;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Consumer only - If there's nothing in the queue, including
+    ///   pushes that are still in progress.
+    bool IsEmpty() const
+    {
+        return m_pTail == &m_stub
+            && m_head.load(std::memory_order_seq_cst) == &m_stub;
+    }
+
+private:
+    std::atomic<MpscNode *> m_head;  // Producers side.
+    MpscNode               *m_pTail; // Consumer side.
+    MpscNode                m_stub;
+};
+
+} // namespace Private
+NS_COREFILE_END
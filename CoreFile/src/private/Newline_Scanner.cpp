@@ -0,0 +1,182 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Newline_Scanner.cpp                                           //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "Newline_Scanner.h"
+// std
+#include <cstring>
+
+// COWNOTE(n2omatt): The SIMD paths rely on the GCC / Clang target
+//   attributes, so the library itself doesn't need to be compiled with
+//   -mavx2 and still runs on older CPUs.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define COREFILE_HAS_X86_SIMD 1
+    #include <immintrin.h>
+#else
+    #define COREFILE_HAS_X86_SIMD 0
+#endif
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Typedefs                                                                   //
+//----------------------------------------------------------------------------//
+typedef void (*ScanFunc)(
+    const char            *pData,
+    size_t                 size,
+    uint64_t               baseOffset,
+    std::vector<uint64_t> &out);
+
+
+//----------------------------------------------------------------------------//
+// Implementations                                                            //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void scan_scalar(
+    const char            *pData,
+    size_t                 size,
+    uint64_t               baseOffset,
+    std::vector<uint64_t> &out)
+{
+    auto p_curr = pData;
+    auto p_end  = pData + size;
+
+    while(p_curr < p_end)
+    {
+        auto p_nl = static_cast<const char *>(memchr(p_curr, '\n', p_end - p_curr));
+        if(!p_nl)
+            break;
+
+        out.push_back(baseOffset + (p_nl - pData) + 1);
+        p_curr = p_nl + 1;
+    }
+}
+
+#if COREFILE_HAS_X86_SIMD
+//------------------------------------------------------------------------------
+// Pushes the offsets of the bits set in the mask.
+static inline void push_mask(
+    uint32_t               mask,
+    uint64_t               offset,
+    std::vector<uint64_t> &out)
+{
+    while(mask)
+    {
+        out.push_back(offset + __builtin_ctz(mask) + 1);
+        mask &= (mask - 1);
+    }
+}
+
+//------------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static void scan_sse2(
+    const char            *pData,
+    size_t                 size,
+    uint64_t               baseOffset,
+    std::vector<uint64_t> &out)
+{
+    const auto nl = _mm_set1_epi8('\n');
+
+    size_t i = 0;
+    for(; i + 16 <= size; i += 16)
+    {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + i));
+        auto mask  = _mm_movemask_epi8(_mm_cmpeq_epi8(block, nl));
+        push_mask(static_cast<uint32_t>(mask), baseOffset + i, out);
+    }
+
+    scan_scalar(pData + i, size - i, baseOffset + i, out);
+}
+
+//------------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void scan_avx2(
+    const char            *pData,
+    size_t                 size,
+    uint64_t               baseOffset,
+    std::vector<uint64_t> &out)
+{
+    const auto nl = _mm256_set1_epi8('\n');
+
+    size_t i = 0;
+    for(; i + 32 <= size; i += 32)
+    {
+        auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + i));
+        auto mask  = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, nl));
+        push_mask(static_cast<uint32_t>(mask), baseOffset + i, out);
+    }
+
+    scan_scalar(pData + i, size - i, baseOffset + i, out);
+}
+#endif // COREFILE_HAS_X86_SIMD
+
+
+//----------------------------------------------------------------------------//
+// Dispatch                                                                   //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static ScanFunc select_impl(const char **ppName)
+{
+#if COREFILE_HAS_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) { *ppName = "avx2"; return scan_avx2; }
+    if(__builtin_cpu_supports("sse2")) { *ppName = "sse2"; return scan_sse2; }
+#endif
+
+    *ppName = "scalar";
+    return scan_scalar;
+}
+
+//------------------------------------------------------------------------------
+static ScanFunc get_impl(const char **ppName = nullptr)
+{
+    // Thread safe initialization since C++11.
+    static const char *s_pName = nullptr;
+    static ScanFunc    s_func  = select_impl(&s_pName);
+
+    if(ppName)
+        *ppName = s_pName;
+    return s_func;
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void CoreFile::Private::scan_newlines(
+    const char            *pData,
+    size_t                 size,
+    uint64_t               baseOffset,
+    std::vector<uint64_t> &out)
+{
+    get_impl()(pData, size, baseOffset, out);
+}
+
+//------------------------------------------------------------------------------
+const char* CoreFile::Private::scan_newlines_impl_name()
+{
+    const char *p_name = nullptr;
+    get_impl(&p_name);
+
+    return p_name;
+}
@@ -0,0 +1,56 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Newline_Scanner.h                                             //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Finds all the newlines of a buffer using the widest SIMD instruction    //
+//    set available at runtime (AVX2 / SSE2) with a scalar fallback.          //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+// CoreFile
+#include "../../include/CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Appends into out the offset of the byte right after each '\n'
+///   found in [pData, pData + size).
+/// @param baseOffset
+///   Value added to each offset - Useful when scanning a file in chunks.
+/// @note
+///   The implementation is selected once, at the first call, based on
+///   the CPU features.
+void scan_newlines(
+    const char            *pData,
+    size_t                 size,
+    uint64_t               baseOffset,
+    std::vector<uint64_t> &out);
+
+///-----------------------------------------------------------------------------
+/// @brief Name of the implementation chosen by scan_newlines.
+const char* scan_newlines_impl_name();
+
+} // namespace Private
+NS_COREFILE_END
@@ -0,0 +1,89 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Parallel_For.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Runs the same syscall bound function for many items on a few threads,   //
+//    used by the batched APIs (GetMetadata, SetFileTimes...).                //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+// CoreFile
+#include "../../include/CoreFile_Utils.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Calls func(index) for each index of [0, count) - The workers (the
+///   calling thread included) take blocks of blockSize indexes from a
+///   shared counter, so a slow item doesn't hold a whole partition.
+/// @param threads
+///   Maximum number of threads - 0 means hardware_concurrency.
+///   Batches of less than two blocks run on the calling thread.
+/// @note
+///   func must not throw.
+template <typename Func>
+void parallel_for(size_t count, size_t threads, size_t blockSize, Func func)
+{
+    auto run_range = [&](size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i)
+            func(i);
+    };
+
+    if(threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    threads = std::min(threads, count / blockSize);
+    if(threads <= 1)
+    {
+        run_range(0, count);
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        while(true)
+        {
+            auto begin = next.fetch_add(blockSize);
+            if(begin >= count)
+                return;
+
+            run_range(begin, std::min(begin + blockSize, count));
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for(size_t i = 1; i < threads; ++i)
+        pool.emplace_back(worker);
+
+    worker();
+    for(auto &thread : pool)
+        thread.join();
+}
+
+} // namespace Private
+NS_COREFILE_END
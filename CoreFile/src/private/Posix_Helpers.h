@@ -0,0 +1,552 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Posix_Helpers.h                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Private helpers shared by the CoreFile translation units that talk      //
+//    directly with the POSIX file descriptor API.                            //
+//    This header is NOT part of the public interface.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <stdexcept>
+#include <string>
+// POSIX
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+// CoreFile
+#include "../../include/CoreFile.h"
+#include "../../include/CoreFile_Utils.h"
+#include "Instrumentation_Scope.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+
+NS_COREFILE_BEGIN
+namespace Private {
+
+//----------------------------------------------------------------------------//
+// ScopedFd                                                                   //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): Minimal RAII owner of a file descriptor.
+//   Used only inside the implementation files so the early returns and
+//   the exceptions thrown by CoreAssert don't leak descriptors.
+class ScopedFd
+{
+public:
+    explicit ScopedFd(int fd = -1) :
+        m_fd(fd)
+    {
+        // Empty...
+    }
+
+    ~ScopedFd()
+    {
+        Reset();
+    }
+
+    ScopedFd(ScopedFd &&other) :
+        m_fd(other.Release())
+    {
+        // Empty...
+    }
+
+    ScopedFd& operator =(ScopedFd &&other)
+    {
+        if(this != &other)
+            Reset(other.Release());
+        return *this;
+    }
+
+    ScopedFd(const ScopedFd &)            = delete;
+    ScopedFd& operator =(const ScopedFd &) = delete;
+
+public:
+    int  Get    () const { return m_fd;       }
+    bool IsValid() const { return m_fd != -1; }
+
+    int Release()
+    {
+        auto fd = m_fd;
+        m_fd    = -1;
+        return fd;
+    }
+
+    void Reset(int fd = -1)
+    {
+        if(m_fd != -1)
+        {
+            COREFILE_COUNT_SYSCALL();
+            close(m_fd);
+        }
+        m_fd = fd;
+    }
+
+private:
+    int m_fd;
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Converts the FileMode strings to open(2) flags.
+// Follows the fopen(3) semantics - The 'b' is meaningless on POSIX and
+// the 'd' (FileMode::Direct) adds O_DIRECT.
+inline int filemode_to_open_flags(const std::string &filemode)
+{
+    auto mode   = filemode;
+    auto direct = (mode.find('d') != std::string::npos);
+
+    mode.erase(std::remove(mode.begin(), mode.end(), 'b'), mode.end());
+    mode.erase(std::remove(mode.begin(), mode.end(), 'd'), mode.end());
+
+#if defined(O_DIRECT)
+    auto extra = (direct) ? O_DIRECT : 0;
+#else
+    auto extra = 0;
+#endif
+
+    if(mode == "r" ) return extra | O_RDONLY;
+    if(mode == "w" ) return extra | O_WRONLY | O_CREAT | O_TRUNC;
+    if(mode == "r+") return extra | O_RDWR;
+    if(mode == "w+") return extra | O_RDWR   | O_CREAT | O_TRUNC;
+    if(mode == "a"  && !direct) return O_WRONLY | O_CREAT | O_APPEND;
+    if(mode == "a+" && !direct) return O_RDWR   | O_CREAT | O_APPEND;
+
+    COREASSERT_THROW_IF_NOT(
+        false,
+        std::invalid_argument,
+        "Invalid filemode: (%s)",
+        filemode.c_str()
+    );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// The name of the file in the error messages - Callers that only have the
+// descriptor (i.e. Handle) pass an empty filename.
+// Only called when the message is built, so it costs nothing otherwise.
+inline std::string display_name(int fd, const std::string &filename)
+{
+    return (filename.empty()) ? "fd " + std::to_string(fd) : filename;
+}
+
+//------------------------------------------------------------------------------
+// Same of open_fd, but the flags are used as they are (no O_CLOEXEC is
+// added) - For Handle, where it's one of the OpenOptions.
+inline ScopedFd open_fd_exact(
+    const std::string &filename,
+    int                flags,
+    mode_t             mode = 0666)
+{
+    int fd = -1;
+    do {
+        COREFILE_COUNT_SYSCALL();
+        fd = open(filename.c_str(), flags, mode);
+    } while(fd == -1 && errno == EINTR);
+
+#if defined(O_NOATIME)
+    // COWNOTE(n2omatt): O_NOATIME is only allowed for the owner of the
+    //   file (or CAP_FOWNER) - It's just an optimization, so retry
+    //   without it instead of failing.
+    if(fd == -1 && errno == EPERM && (flags & O_NOATIME))
+        return open_fd_exact(filename, flags & ~O_NOATIME, mode);
+#endif
+
+    COREASSERT_THROW_IF_NOT(
+        fd != -1,
+        std::ios::failure,
+        "Failed to open file - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(errno)
+    );
+
+    return ScopedFd(fd);
+}
+
+//------------------------------------------------------------------------------
+// Opens the filename with the given open(2) flags (plus O_CLOEXEC)
+// retrying on EINTR.
+// Throws std::ios::failure if the file couldn't be opened.
+inline ScopedFd open_fd(
+    const std::string &filename,
+    int                flags,
+    mode_t             mode = 0666)
+{
+    return open_fd_exact(filename, flags | O_CLOEXEC, mode);
+}
+
+//------------------------------------------------------------------------------
+// Same of open_fd, but gives an invalid ScopedFd (with errno set)
+// instead of throwing - For the callers where a missing file isn't an
+// error.
+inline ScopedFd try_open_fd(const std::string &filename, int flags)
+{
+    int fd = -1;
+    do {
+        COREFILE_COUNT_SYSCALL();
+        fd = open(filename.c_str(), flags | O_CLOEXEC);
+    } while(fd == -1 && errno == EINTR);
+
+    return ScopedFd(fd);
+}
+
+//------------------------------------------------------------------------------
+// Gets the stat of the file referred by fd.
+inline struct stat fd_stat(int fd, const std::string &filename)
+{
+    COREFILE_COUNT_SYSCALL();
+
+    struct stat st;
+    COREASSERT_THROW_IF_NOT(
+        fstat(fd, &st) == 0,
+        std::runtime_error,
+        "Failed to stat file - filename: (%s) - error: (%s)",
+        filename.c_str(),
+        strerror(errno)
+    );
+
+    return st;
+}
+
+//------------------------------------------------------------------------------
+// Gets the size of the file referred by fd with a single fstat(2).
+inline size_t fd_size(int fd, const std::string &filename)
+{
+    return static_cast<size_t>(fd_stat(fd, filename).st_size);
+}
+
+//------------------------------------------------------------------------------
+// Writes the whole buffer to fd, handling short writes and EINTR.
+// Huge buffers are sent in large chunks because write(2) transfers at
+// most 0x7ffff000 bytes per call on Linux.
+inline void write_all(
+    int                fd,
+    const void        *pData,
+    size_t             size,
+    const std::string &filename)
+{
+    const size_t kMaxChunkSize = 1 << 30;
+
+    auto p_curr = static_cast<const char *>(pData);
+    while(size > 0)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = write(fd, p_curr, std::min(size, kMaxChunkSize));
+        if(n < 0 && errno == EINTR)
+            continue;
+
+        COREASSERT_THROW_IF_NOT(
+            n >= 0,
+            std::runtime_error,
+            "Failed to write file - filename: (%s) - error: (%s)",
+            display_name(fd, filename).c_str(),
+            strerror(errno)
+        );
+
+        p_curr += n;
+        size   -= n;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Same of write_all, but at offset with pwrite(2) - The file position
+// isn't used nor changed.
+inline void pwrite_all(
+    int                fd,
+    const void        *pData,
+    size_t             size,
+    uint64_t           offset,
+    const std::string &filename)
+{
+    const size_t kMaxChunkSize = 1 << 30;
+
+    auto p_curr = static_cast<const char *>(pData);
+    while(size > 0)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = pwrite(
+            fd,
+            p_curr,
+            std::min(size, kMaxChunkSize),
+            static_cast<off_t>(offset)
+        );
+        if(n < 0 && errno == EINTR)
+            continue;
+
+        COREASSERT_THROW_IF_NOT(
+            n >= 0,
+            std::runtime_error,
+            "Failed to write file - filename: (%s) - error: (%s)",
+            display_name(fd, filename).c_str(),
+            strerror(errno)
+        );
+
+        p_curr += n;
+        size   -= n;
+        offset += n;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Writes all the buffers with writev(2) - Or with pwritev(2) at *pOffset
+// when pOffset isn't nullptr (it's advanced by the bytes written).
+// Handles short writes, EINTR and more than IOV_MAX buffers.
+// COWNOTE(n2omatt): A short writev(2) can stop in the middle of a
+//   buffer - Instead of copying (and modifying) the caller's iovecs the
+//   fully written ones are skipped and the rest of the partial one is
+//   sent with write_all / pwrite_all.
+inline void writev_all(
+    int                 fd,
+    const struct iovec *pIov,
+    int                 count,
+    uint64_t           *pOffset,
+    const std::string  &filename)
+{
+    while(count > 0)
+    {
+        auto batch = std::min(count, IOV_MAX);
+
+        COREFILE_COUNT_SYSCALL();
+        auto n = (pOffset)
+            ? pwritev(fd, pIov, batch, static_cast<off_t>(*pOffset))
+            : writev (fd, pIov, batch);
+
+        if(n < 0 && errno == EINTR)
+            continue;
+
+        COREASSERT_THROW_IF_NOT(
+            n >= 0,
+            std::runtime_error,
+            "Failed to write file - filename: (%s) - error: (%s)",
+            display_name(fd, filename).c_str(),
+            strerror(errno)
+        );
+
+        if(pOffset)
+            *pOffset += n;
+
+        // Skip the buffers that were fully written.
+        auto written = static_cast<size_t>(n);
+        while(count > 0 && written >= pIov->iov_len)
+        {
+            written -= pIov->iov_len;
+            ++pIov;
+            --count;
+        }
+
+        // Finish the partially written one.
+        if(count > 0 && written > 0)
+        {
+            auto p_rest = static_cast<const char *>(pIov->iov_base) + written;
+            auto rest   = pIov->iov_len - written;
+
+            if(pOffset)
+            {
+                pwrite_all(fd, p_rest, rest, *pOffset, filename);
+                *pOffset += rest;
+            }
+            else
+            {
+                write_all(fd, p_rest, rest, filename);
+            }
+
+            ++pIov;
+            --count;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Reads at the current position until size bytes were read, handling
+// short reads and EINTR.
+// Returns the number of bytes read - Smaller than size only at EOF.
+inline size_t read_all(
+    int                fd,
+    void              *pData,
+    size_t             size,
+    const std::string &filename)
+{
+    auto p_curr = static_cast<char *>(pData);
+    auto done   = size_t(0);
+
+    while(done < size)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = read(fd, p_curr + done, size - done);
+        if(n < 0 && errno == EINTR)
+            continue;
+
+        COREASSERT_THROW_IF_NOT(
+            n >= 0,
+            std::runtime_error,
+            "Failed to read file - filename: (%s) - error: (%s)",
+            display_name(fd, filename).c_str(),
+            strerror(errno)
+        );
+
+        if(n == 0)
+            break;
+        done += n;
+    }
+
+    return done;
+}
+
+//------------------------------------------------------------------------------
+// Reads exactly size bytes at offset, handling short reads and EINTR.
+// Returns the number of bytes read - Smaller than size only at EOF.
+inline size_t pread_all(
+    int                fd,
+    void              *pData,
+    size_t             size,
+    uint64_t           offset,
+    const std::string &filename)
+{
+    auto p_curr = static_cast<char *>(pData);
+    auto done   = size_t(0);
+
+    while(done < size)
+    {
+        COREFILE_COUNT_SYSCALL();
+        auto n = pread(fd, p_curr + done, size - done, offset + done);
+        if(n < 0 && errno == EINTR)
+            continue;
+
+        COREASSERT_THROW_IF_NOT(
+            n >= 0,
+            std::runtime_error,
+            "Failed to read file - filename: (%s) - error: (%s)",
+            display_name(fd, filename).c_str(),
+            strerror(errno)
+        );
+
+        if(n == 0)
+            break;
+        done += n;
+    }
+
+    return done;
+}
+
+//------------------------------------------------------------------------------
+// Reads the whole file into the container with as few pread(2) as
+// possible - size is the one reported by fstat(2).
+// Some files (i.e. /proc) report size 0, those are read until EOF.
+// Returns the number of bytes read - The container is resized to it.
+template <typename Container>
+inline size_t pread_whole(
+    int                fd,
+    size_t             size,
+    Container         &container,
+    const std::string &filename)
+{
+    // Common case - A single read of the size reported by fstat(2).
+    container.resize(size);
+
+    auto done = size_t(0);
+    if(size > 0)
+        done = pread_all(fd, &container[0], size, 0, filename);
+
+    if(size == 0)
+    {
+        while(true)
+        {
+            container.resize(std::max<size_t>(done * 2, 4096));
+
+            auto n = pread_all(
+                fd,
+                &container[done],
+                container.size() - done,
+                done,
+                filename
+            );
+
+            done += n;
+            if(done < container.size())
+                break;
+        }
+    }
+
+    container.resize(done);
+    return done;
+}
+
+//------------------------------------------------------------------------------
+// Flushes the file according the durability policy.
+inline void sync_file(int fd, Durability durability, const std::string &filename)
+{
+    if(durability == Durability::None)
+        return;
+
+    COREFILE_COUNT_SYSCALL();
+    auto result = (durability == Durability::Data)
+        ? fdatasync(fd)
+        : fsync    (fd);
+
+    COREASSERT_THROW_IF_NOT(
+        result == 0,
+        std::runtime_error,
+        "Failed to sync file - filename: (%s) - error: (%s)",
+        display_name(fd, filename).c_str(),
+        strerror(errno)
+    );
+}
+
+//------------------------------------------------------------------------------
+// Directory part of the filename - "." if there's none.
+inline std::string parent_directory(const std::string &filename)
+{
+    auto index = filename.find_last_of('/');
+    if(index == std::string::npos)
+        return ".";
+    if(index == 0)
+        return "/";
+
+    return filename.substr(0, index);
+}
+
+//------------------------------------------------------------------------------
+// Flushes the directory that contains filename, so a newly created or
+// renamed entry survives a crash.
+inline void fsync_parent_directory(const std::string &filename)
+{
+    auto dirname = parent_directory(filename);
+    auto fd      = open_fd(dirname, O_RDONLY | O_DIRECTORY);
+
+    COREFILE_COUNT_SYSCALL();
+    COREASSERT_THROW_IF_NOT(
+        fsync(fd.Get()) == 0,
+        std::runtime_error,
+        "Failed to sync directory - dirname: (%s) - error: (%s)",
+        dirname.c_str(),
+        strerror(errno)
+    );
+}
+
+} // namespace Private
+NS_COREFILE_END
@@ -0,0 +1,261 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Bench_Helpers.h                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Data files and legacy implementations shared by the benchmarks.         //
+//    The files live under COREFILE_BENCH_DIR (or TMPDIR) and are created     //
+//    once per size - COREFILE_BENCH_MAX_SIZE caps the sizes (in bytes).      //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+// POSIX
+#include <ftw.h>
+#include <unistd.h>
+// Google Benchmark
+#include <benchmark/benchmark.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+
+
+namespace Bench {
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+const int64_t kKB = 1024;
+const int64_t kMB = 1024 * kKB;
+const int64_t kGB = 1024 * kMB;
+
+
+//----------------------------------------------------------------------------//
+// Sizes                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Biggest size that will be benchmarked.
+inline int64_t GetMaxSize()
+{
+    auto p_max = getenv("COREFILE_BENCH_MAX_SIZE");
+    return (p_max) ? strtoll(p_max, nullptr, 10) : 4 * kGB;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Adds the sizes from minSize to maxSize (x16 each step) to the
+///   benchmark - Those above COREFILE_BENCH_MAX_SIZE are skipped.
+///   Each size gets a hot and a cold cache (second arg 1) variant
+///   when withCold is true.
+inline void AddSizes(
+    benchmark::internal::Benchmark *pBenchmark,
+    int64_t                         minSize,
+    int64_t                         maxSize,
+    bool                            withCold)
+{
+    maxSize = std::min(maxSize, GetMaxSize());
+    for(auto size = minSize; size <= maxSize; size *= 16)
+    {
+        pBenchmark->Args({size, 0});
+        if(withCold)
+            pBenchmark->Args({size, 1});
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Files                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief The directory of the data files - Removed at exit.
+class DataDir
+{
+public:
+    static DataDir& Get()
+    {
+        static DataDir s_dir;
+        return s_dir;
+    }
+
+    ~DataDir()
+    {
+        nftw(
+            m_path.c_str(),
+            [](const char *pPath, const struct stat *, int, FTW *) {
+                return remove(pPath);
+            },
+            16,
+            FTW_DEPTH | FTW_PHYS
+        );
+    }
+
+private:
+    DataDir()
+    {
+        auto p_dir = getenv("COREFILE_BENCH_DIR");
+        if(!p_dir)
+            p_dir = getenv("TMPDIR");
+
+        m_path = std::string(p_dir ? p_dir : "/tmp") + "/CoreFile_bench_XXXXXX";
+        if(!mkdtemp(&m_path[0]))
+            abort();
+    }
+
+public:
+    std::string Path(const std::string &name) const
+    {
+        return m_path + "/" + name;
+    }
+
+private:
+    std::string m_path;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief Deterministic bytes that don't compress too well.
+inline std::vector<CoreFile::byte_t> MakeData(size_t size)
+{
+    std::vector<CoreFile::byte_t> data(size);
+
+    auto state = uint32_t(2463534242u);
+    for(auto &b : data)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        b = CoreFile::byte_t(state);
+    }
+
+    return data;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The path of a file of size bytes - Text files have lines of
+///   1 to 120 chars. Created on the first call and written in chunks,
+///   so the big ones don't need the memory.
+inline std::string GetDataFile(int64_t size, bool text = false)
+{
+    static std::mutex                    s_mutex;
+    static std::map<int64_t, std::string> s_binaryFiles;
+    static std::map<int64_t, std::string> s_textFiles;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    auto &files = (text) ? s_textFiles : s_binaryFiles;
+    auto  it    = files.find(size);
+    if(it != files.end())
+        return it->second;
+
+    auto filename = DataDir::Get().Path(
+        std::string((text) ? "text_" : "data_") + std::to_string(size)
+    );
+
+    auto chunk = MakeData(static_cast<size_t>(std::min(size, 4 * kMB)));
+    if(text)
+    {
+        for(size_t i = 0; i < chunk.size(); ++i)
+        {
+            chunk[i] = (chunk[i] % 121 == 0)
+                ? '\n'
+                : static_cast<CoreFile::byte_t>('a' + chunk[i] % 26);
+        }
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    for(int64_t written = 0; written < size; )
+    {
+        auto n = std::min<int64_t>(size - written, chunk.size());
+        file.write(reinterpret_cast<const char *>(chunk.data()), n);
+        written += n;
+    }
+
+    files[size] = filename;
+    return filename;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Evicts the file from the page cache when the benchmark is a cold
+///   cache one - The time isn't counted.
+inline void PrepareCache(benchmark::State &state, const std::string &filename)
+{
+    if(state.range(1) == 0)
+        return;
+
+    state.PauseTiming();
+    CoreFile::DropFromPageCache(filename);
+    state.ResumeTiming();
+}
+
+
+//----------------------------------------------------------------------------//
+// Legacy                                                                     //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): What the functions did before the bulk paths - Kept
+//   here as the baseline of the comparisons.
+//------------------------------------------------------------------------------
+inline std::vector<CoreFile::byte_t> LegacyReadAllBytes(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    file.seekg(0, std::ios::end);
+    auto size = static_cast<size_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    std::vector<CoreFile::byte_t> bytes(size);
+    file.read(reinterpret_cast<char *>(bytes.data()), size);
+
+    return bytes;
+}
+
+//------------------------------------------------------------------------------
+inline std::vector<std::string> LegacyReadAllLines(const std::string &filename)
+{
+    std::vector<std::string> lines;
+
+    std::ifstream file(filename);
+    while(!file.eof())
+    {
+        std::string line;
+        std::getline(file, line);
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+//------------------------------------------------------------------------------
+inline void LegacyWriteAllBytes(
+    const std::string                   &filename,
+    const std::vector<CoreFile::byte_t> &bytes)
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    std::copy(
+        bytes.begin(),
+        bytes.end(),
+        std::ostream_iterator<CoreFile::byte_t>(file)
+    );
+}
+
+} // namespace Bench
@@ -0,0 +1,87 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Copy_Bench.cpp                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Copy (kernel side copy) against the legacy ReadAllBytes + WriteAllBytes.//
+//    Args are {size, cold} - cold 1 drops the source from the page cache     //
+//    before each iteration.                                                  //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <string>
+// Google Benchmark
+#include <benchmark/benchmark.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Bench
+#include "Bench_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void copy_sizes(benchmark::internal::Benchmark *pBenchmark)
+{
+    Bench::AddSizes(pBenchmark, 4 * Bench::kKB, 4 * Bench::kGB, true);
+    pBenchmark->UseRealTime();
+}
+
+//------------------------------------------------------------------------------
+// Each thread copies to its own file.
+static std::string copy_filename(const benchmark::State &state)
+{
+    return Bench::DataDir::Get().Path(
+        "copy_" + std::to_string(state.range(0)) +
+        "_"     + std::to_string(state.thread_index())
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void BM_Copy(benchmark::State &state)
+{
+    auto src = Bench::GetDataFile(state.range(0));
+    auto dst = copy_filename(state);
+    for(auto _ : state)
+    {
+        Bench::PrepareCache(state, src);
+        Copy(src, dst, true);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Copy)->Apply(copy_sizes);
+BENCHMARK(BM_Copy)->Apply(copy_sizes)->ThreadRange(2, 8);
+
+//------------------------------------------------------------------------------
+static void BM_Copy_Legacy(benchmark::State &state)
+{
+    auto src = Bench::GetDataFile(state.range(0));
+    auto dst = copy_filename(state);
+    for(auto _ : state)
+    {
+        Bench::PrepareCache(state, src);
+        Bench::LegacyWriteAllBytes(dst, Bench::LegacyReadAllBytes(src));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Copy_Legacy)->Apply(copy_sizes);
@@ -0,0 +1,72 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileTime_Bench.cpp                                            //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ToLocalTime against localtime_r(3) with more and more threads - The     //
+//    cached offsets should scale, localtime_r takes the glibc tz lock.       //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <ctime>
+// Google Benchmark
+#include <benchmark/benchmark.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Times a second apart, like the mtimes of a directory listing - A new
+// cache window every 900 of them.
+static time_t next_time(time_t &time)
+{
+    return ++time;
+}
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void BM_ToLocalTime(benchmark::State &state)
+{
+    time_t time = 1700000000 + state.thread_index() * 86400;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(ToLocalTime(next_time(time)));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ToLocalTime)->ThreadRange(1, 16)->UseRealTime();
+
+//------------------------------------------------------------------------------
+static void BM_LocalTimeR(benchmark::State &state)
+{
+    time_t time = 1700000000 + state.thread_index() * 86400;
+    for(auto _ : state)
+    {
+        auto t = next_time(time);
+        tm_t tm;
+        benchmark::DoNotOptimize(localtime_r(&t, &tm));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LocalTimeR)->ThreadRange(1, 16)->UseRealTime();
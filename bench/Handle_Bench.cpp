@@ -0,0 +1,106 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Handle_Bench.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Small random reads with Handle::ReadAt against std::fstream.            //
+//    Args are {read size} - The file is 256MB (or COREFILE_BENCH_MAX_SIZE).  //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <fstream>
+#include <vector>
+// Google Benchmark
+#include <benchmark/benchmark.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Bench
+#include "Bench_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static int64_t random_file_size()
+{
+    return std::min(256 * Bench::kMB, Bench::GetMaxSize());
+}
+
+//------------------------------------------------------------------------------
+// Same sequence of offsets for both benchmarks (and for each thread).
+static uint64_t next_offset(uint64_t &state, int64_t fileSize, int64_t readSize)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+
+    return state % static_cast<uint64_t>(fileSize - readSize + 1);
+}
+
+//------------------------------------------------------------------------------
+static void random_sizes(benchmark::internal::Benchmark *pBenchmark)
+{
+    pBenchmark->Arg(64)->Arg(512)->Arg(4 * Bench::kKB);
+    pBenchmark->ThreadRange(1, 8)->UseRealTime();
+}
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void BM_RandomRead_Handle(benchmark::State &state)
+{
+    auto file_size = random_file_size();
+    auto read_size = state.range(0);
+
+    Handle handle(Bench::GetDataFile(file_size), OpenOptions::Read);
+    std::vector<char> buffer(read_size);
+
+    uint64_t seed = 88172645463325252ull;
+    for(auto _ : state)
+    {
+        auto offset = next_offset(seed, file_size, read_size);
+        benchmark::DoNotOptimize(handle.ReadAt(buffer.data(), buffer.size(), offset));
+    }
+    state.SetBytesProcessed(state.iterations() * read_size);
+}
+BENCHMARK(BM_RandomRead_Handle)->Apply(random_sizes);
+
+//------------------------------------------------------------------------------
+static void BM_RandomRead_Fstream(benchmark::State &state)
+{
+    auto file_size = random_file_size();
+    auto read_size = state.range(0);
+
+    std::ifstream file(Bench::GetDataFile(file_size), std::ios::binary);
+    std::vector<char> buffer(read_size);
+
+    uint64_t seed = 88172645463325252ull;
+    for(auto _ : state)
+    {
+        auto offset = next_offset(seed, file_size, read_size);
+        file.seekg(offset);
+        file.read(buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(file.gcount());
+    }
+    state.SetBytesProcessed(state.iterations() * read_size);
+}
+BENCHMARK(BM_RandomRead_Fstream)->Apply(random_sizes);
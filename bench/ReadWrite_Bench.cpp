@@ -0,0 +1,186 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ReadWrite_Bench.cpp                                           //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ReadAll* / WriteAll* / GetSize against the legacy stream versions.      //
+//    Args are {size, cold} - cold 1 drops the file from the page cache       //
+//    before each iteration.                                                  //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <string>
+#include <vector>
+// Google Benchmark
+#include <benchmark/benchmark.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Bench
+#include "Bench_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Registration Helpers                                                       //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Hot and cold cache with a single thread plus hot cache with more
+// threads (all reading the same file).
+static void read_sizes(benchmark::internal::Benchmark *pBenchmark)
+{
+    Bench::AddSizes(pBenchmark, 4 * Bench::kKB, 4 * Bench::kGB, true);
+    pBenchmark->UseRealTime();
+}
+
+static void read_sizes_threaded(benchmark::internal::Benchmark *pBenchmark)
+{
+    Bench::AddSizes(pBenchmark, 4 * Bench::kKB, 4 * Bench::kGB, false);
+    pBenchmark->ThreadRange(2, 8)->UseRealTime();
+}
+
+static void write_sizes(benchmark::internal::Benchmark *pBenchmark)
+{
+    Bench::AddSizes(pBenchmark, Bench::kKB, Bench::kGB, false);
+    pBenchmark->UseRealTime();
+}
+
+
+//----------------------------------------------------------------------------//
+// ReadAllBytes                                                               //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void BM_ReadAllBytes(benchmark::State &state)
+{
+    auto filename = Bench::GetDataFile(state.range(0));
+    for(auto _ : state)
+    {
+        Bench::PrepareCache(state, filename);
+        benchmark::DoNotOptimize(ReadAllBytes(filename));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadAllBytes)->Apply(read_sizes);
+BENCHMARK(BM_ReadAllBytes)->Apply(read_sizes_threaded);
+
+//------------------------------------------------------------------------------
+static void BM_ReadAllBytes_Legacy(benchmark::State &state)
+{
+    auto filename = Bench::GetDataFile(state.range(0));
+    for(auto _ : state)
+    {
+        Bench::PrepareCache(state, filename);
+        benchmark::DoNotOptimize(Bench::LegacyReadAllBytes(filename));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadAllBytes_Legacy)->Apply(read_sizes);
+
+
+//----------------------------------------------------------------------------//
+// ReadAllLines                                                               //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void BM_ReadAllLines(benchmark::State &state)
+{
+    auto filename = Bench::GetDataFile(state.range(0), true);
+    for(auto _ : state)
+    {
+        Bench::PrepareCache(state, filename);
+        benchmark::DoNotOptimize(ReadAllLines(filename));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadAllLines)->Apply(read_sizes);
+BENCHMARK(BM_ReadAllLines)->Apply(read_sizes_threaded);
+
+//------------------------------------------------------------------------------
+static void BM_ReadAllLines_Legacy(benchmark::State &state)
+{
+    auto filename = Bench::GetDataFile(state.range(0), true);
+    for(auto _ : state)
+    {
+        Bench::PrepareCache(state, filename);
+        benchmark::DoNotOptimize(Bench::LegacyReadAllLines(filename));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReadAllLines_Legacy)->Apply(read_sizes);
+
+
+//----------------------------------------------------------------------------//
+// WriteAllBytes                                                              //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Each thread writes its own file.
+static std::string write_filename(const benchmark::State &state)
+{
+    return Bench::DataDir::Get().Path(
+        "write_" + std::to_string(state.range(0)) +
+        "_"      + std::to_string(state.thread_index())
+    );
+}
+
+//------------------------------------------------------------------------------
+static void BM_WriteAllBytes(benchmark::State &state)
+{
+    auto filename = write_filename(state);
+    auto bytes    = Bench::MakeData(state.range(0));
+    for(auto _ : state)
+        WriteAllBytes(filename, bytes);
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteAllBytes)->Apply(write_sizes);
+BENCHMARK(BM_WriteAllBytes)->Apply(write_sizes)->ThreadRange(2, 8);
+
+//------------------------------------------------------------------------------
+static void BM_WriteAllBytes_Legacy(benchmark::State &state)
+{
+    auto filename = write_filename(state);
+    auto bytes    = Bench::MakeData(state.range(0));
+    for(auto _ : state)
+        Bench::LegacyWriteAllBytes(filename, bytes);
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WriteAllBytes_Legacy)->Apply(write_sizes);
+
+
+//----------------------------------------------------------------------------//
+// GetSize                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// The size doesn't change the cost - A single small file is enough.
+static void BM_GetSize(benchmark::State &state)
+{
+    auto filename = Bench::GetDataFile(4 * Bench::kKB);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(GetSize(filename));
+}
+BENCHMARK(BM_GetSize)->ThreadRange(1, 8)->UseRealTime();
+
+//------------------------------------------------------------------------------
+static void BM_GetSize_Stream(benchmark::State &state)
+{
+    auto filename = Bench::GetDataFile(4 * Bench::kKB);
+    for(auto _ : state)
+    {
+        std::fstream file(filename, std::ios::in | std::ios::binary);
+        benchmark::DoNotOptimize(GetSize(file));
+    }
+}
+BENCHMARK(BM_GetSize_Stream)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,157 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Appender_Tests.cpp                                            //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+static const int kProducerCount      = 8;
+static const int kRecordsPerProducer = 2000;
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(Appender, ProducersLoseNothingAndKeepTheirOrder)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    // Small batches, so the producers race with many commits.
+    Appender::Options options;
+    options.maxBatchBytes = 256;
+
+    {
+        Appender appender(filename, options);
+
+        std::vector<std::thread> producers;
+        for(int producer = 0; producer < kProducerCount; ++producer)
+        {
+            producers.emplace_back([&appender, producer]() {
+                for(int i = 0; i < kRecordsPerProducer; ++i)
+                {
+                    appender.AppendLine(
+                        std::to_string(producer) + " " + std::to_string(i)
+                    );
+                }
+            });
+        }
+
+        for(auto &thread : producers)
+            thread.join();
+
+        appender.Flush();
+        EXPECT_EQ(appender.GetBytesWritten(), GetSize(filename));
+    }
+
+    // Every record is a whole line, in order within its producer.
+    std::vector<int> next(kProducerCount, 0);
+    auto lines = ReadAllLines(filename);
+    ASSERT_EQ(lines.back(), ""); // After the last new line.
+    lines.pop_back();
+
+    ASSERT_EQ(lines.size(), size_t(kProducerCount * kRecordsPerProducer));
+    for(const auto &line : lines)
+    {
+        int producer = -1, i = -1;
+        ASSERT_EQ(sscanf(line.c_str(), "%d %d", &producer, &i), 2) << line;
+        ASSERT_TRUE(producer >= 0 && producer < kProducerCount) << line;
+        EXPECT_EQ(i, next[producer]++) << line;
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(Appender, FlushWritesWhatWasAppendedBefore)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    // A latency long enough that only the Flush commits the batch.
+    Appender::Options options;
+    options.durability = Durability::Data;
+    options.maxLatency = std::chrono::seconds(60);
+
+    Appender appender(filename, options);
+    appender.Append("a");
+    appender.Append(std::string("b\0c", 3));
+    appender.Append("");
+
+    appender.Flush();
+    EXPECT_EQ(ReadAllText(filename), std::string("ab\0c", 4));
+    EXPECT_EQ(appender.GetBytesWritten(),     4u);
+    EXPECT_EQ(appender.GetBatchesCommitted(), 1u);
+
+    // Nothing pending - Flush doesn't commit an empty batch.
+    appender.Flush();
+    EXPECT_EQ(appender.GetBatchesCommitted(), 1u);
+}
+
+//------------------------------------------------------------------------------
+TEST(Appender, AppendsToTheExistingContents)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "old\n");
+
+    {
+        Appender appender(filename);
+        appender.Append("new\n");
+    }
+
+    EXPECT_EQ(ReadAllText(filename), "old\nnew\n");
+}
+
+//------------------------------------------------------------------------------
+TEST(Appender, FailedBatchIsReportedByTheNextCalls)
+{
+    // Every write to /dev/full fails with ENOSPC.
+    Appender appender("/dev/full");
+    appender.Append("record");
+
+    EXPECT_THROW(appender.Flush(),           std::runtime_error);
+    EXPECT_THROW(appender.Append("another"), std::runtime_error);
+    EXPECT_THROW(appender.Flush(),           std::runtime_error);
+    EXPECT_EQ(appender.GetBytesWritten(), 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(Appender, ThrowsIfTheFileCantBeOpened)
+{
+    Tests::TempDir dir;
+    EXPECT_THROW(Appender(dir.Path("missing/file")), std::ios::failure);
+}
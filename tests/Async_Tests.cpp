@@ -0,0 +1,252 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Async_Tests.cpp                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+// POSIX
+#include <fcntl.h>
+#include <unistd.h>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Types                                                               //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): Each completion submits the next read from inside
+//   its callback - Exactly what deadlocked when the callback held the
+//   slot and Submit waited for one.
+class ChainedReads
+{
+public:
+    ChainedReads(AsyncIO &io, int fd, size_t total) :
+        // Members.
+        m_io       (io),
+        m_fd       (fd),
+        m_total    (total),
+        m_completed(0),
+        m_errors   (0),
+        m_buffers  (total)
+    {
+        // Empty...
+    }
+
+    void Start(size_t chains)
+    {
+        for(size_t i = 0; i < chains; ++i)
+            SubmitNext();
+    }
+
+    bool Wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_cond.wait_for(lock, std::chrono::seconds(30), [this]() {
+            return m_completed == m_total;
+        });
+    }
+
+    size_t GetErrors() const { return m_errors; }
+
+private:
+    void SubmitNext()
+    {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_submitted.size() == m_total)
+                return;
+            index = m_submitted.size();
+            m_submitted.push_back(index);
+        }
+
+        AsyncOperation op;
+        op.type     = AsyncOperation::Type::Read;
+        op.fd       = m_fd;
+        op.pBuffer  = &m_buffers[index];
+        op.size     = 1;
+        op.offset   = index % 4096;
+        op.callback = [this](int error, size_t /* bytes */) {
+            if(error != 0)
+                ++m_errors;
+
+            SubmitNext();
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ++m_completed;
+            }
+            m_cond.notify_all();
+        };
+
+        m_io.Submit(op);
+    }
+
+private:
+    AsyncIO                &m_io;
+    int                     m_fd;
+    size_t                  m_total;
+    size_t                  m_completed;
+    std::atomic<size_t>     m_errors;
+    std::vector<char>       m_buffers;
+    std::vector<size_t>     m_submitted;
+    std::mutex              m_mutex;
+    std::condition_variable m_cond;
+};
+
+
+//----------------------------------------------------------------------------//
+// Fixture                                                                    //
+//----------------------------------------------------------------------------//
+class AsyncTests :
+    public ::testing::TestWithParam<AsyncBackend>
+{
+protected:
+    void SetUp() override
+    {
+        m_filename = m_dir.Path("data.bin");
+        WriteAllText(m_filename, Tests::MakeData(4096));
+
+        m_fd = open(m_filename.c_str(), O_RDONLY | O_CLOEXEC);
+        ASSERT_NE(m_fd, -1);
+    }
+
+    void TearDown() override
+    {
+        if(m_fd != -1)
+            close(m_fd);
+    }
+
+    // nullptr if the backend isn't available on this system.
+    std::unique_ptr<AsyncIO> MakeIO(size_t queueDepth)
+    {
+        try {
+            return std::unique_ptr<AsyncIO>(
+                new AsyncIO(GetParam(), queueDepth, 2)
+            );
+        } catch(const std::runtime_error &) {
+            return nullptr;
+        }
+    }
+
+protected:
+    Tests::TempDir m_dir;
+    std::string    m_filename;
+    int            m_fd = -1;
+};
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST_P(AsyncTests, CallbackCanSubmitWithFullQueue)
+{
+    auto p_io = MakeIO(1);
+    if(!p_io)
+        GTEST_SKIP();
+
+    ChainedReads chain(*p_io, m_fd, 2000);
+    chain.Start(1);
+
+    ASSERT_TRUE(chain.Wait());
+    EXPECT_EQ(chain.GetErrors(), 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST_P(AsyncTests, CallbacksCanSubmitMoreThanTheQueueHolds)
+{
+    auto p_io = MakeIO(4);
+    if(!p_io)
+        GTEST_SKIP();
+
+    ChainedReads chain(*p_io, m_fd, 2000);
+    chain.Start(64);
+
+    ASSERT_TRUE(chain.Wait());
+    EXPECT_EQ(chain.GetErrors(), 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST_P(AsyncTests, BatchBiggerThanTheQueueCompletes)
+{
+    auto p_io = MakeIO(2);
+    if(!p_io)
+        GTEST_SKIP();
+
+    auto expected = ReadAllBytes(m_filename);
+    std::vector<char>   buffer(expected.size());
+    std::atomic<size_t> bytes(0);
+
+    std::vector<AsyncOperation> ops;
+    for(size_t offset = 0; offset < buffer.size(); offset += 64)
+    {
+        AsyncOperation op;
+        op.type     = AsyncOperation::Type::Read;
+        op.fd       = m_fd;
+        op.pBuffer  = &buffer[offset];
+        op.size     = 64;
+        op.offset   = offset;
+        op.callback = [&bytes](int error, size_t n) {
+            if(error == 0)
+                bytes += n;
+        };
+        ops.push_back(op);
+    }
+
+    // The destructor waits for all of them - Overflowed ones included.
+    p_io->Submit(ops);
+    p_io.reset();
+
+    EXPECT_EQ(bytes.load(), buffer.size());
+    EXPECT_EQ(0, memcmp(buffer.data(), expected.data(), buffer.size()));
+}
+
+//------------------------------------------------------------------------------
+TEST_P(AsyncTests, FailedOperationReportsError)
+{
+    auto p_io = MakeIO(4);
+    if(!p_io)
+        GTEST_SKIP();
+
+    char buffer[16];
+    auto future = p_io->Read(-1, buffer, sizeof(buffer), 0);
+
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+INSTANTIATE_TEST_CASE_P(
+    Backends,
+    AsyncTests,
+    ::testing::Values(AsyncBackend::IoUring, AsyncBackend::ThreadPool)
+);
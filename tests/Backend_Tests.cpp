@@ -0,0 +1,231 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Backend_Tests.cpp                                             //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <ios>
+#include <string>
+#include <thread>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void write(Backend &backend, const std::string &filename, const std::string &contents)
+{
+    backend.WriteFile(
+        filename,
+        contents.data(),
+        contents.size(),
+        WriteMode::Truncate,
+        Durability::None
+    );
+}
+
+//------------------------------------------------------------------------------
+static std::string read(Backend &backend, const std::string &filename)
+{
+    std::string contents;
+    EXPECT_TRUE(backend.ReadFile(filename, contents)) << filename;
+
+    return contents;
+}
+
+
+//----------------------------------------------------------------------------//
+// PosixBackend                                                               //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(PosixBackend, ReplaceKeepsABackup)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("dst"), "old");
+    WriteAllText(dir.Path("src"), "new");
+
+    Replace(dir.Path("src"), dir.Path("dst"), dir.Path("backup"));
+    EXPECT_FALSE(Exist(dir.Path("src")));
+    EXPECT_EQ(ReadAllText(dir.Path("dst")),    "new");
+    EXPECT_EQ(ReadAllText(dir.Path("backup")), "old");
+}
+
+
+//----------------------------------------------------------------------------//
+// MemoryBackend                                                              //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(MemoryBackend, MovesBackAndForth)
+{
+    MemoryBackend backend;
+    write(backend, "a", "contents");
+
+    backend.MoveFile("a", "b", false);
+    EXPECT_FALSE(backend.IsFile("a"));
+    EXPECT_EQ(read(backend, "b"), "contents");
+
+    backend.MoveFile("b", "a", false);
+    EXPECT_EQ(backend.GetFilenames(), std::vector<std::string> { "a" });
+    EXPECT_EQ(read(backend, "a"), "contents");
+}
+
+//------------------------------------------------------------------------------
+TEST(MemoryBackend, OppositeTransfersDontDeadlock)
+{
+    MemoryBackend backend;
+
+    std::vector<std::string> names;
+    for(int i = 0; i < 32; ++i)
+    {
+        names.push_back("a_" + std::to_string(i));
+        names.push_back("b_" + std::to_string(i));
+        write(backend, names[names.size() - 2], "a");
+        write(backend, names[names.size() - 1], "b");
+    }
+
+    // Each thread copies the pairs in the opposite direction of the
+    // other - Pairs whose stripes differ take both locks in both orders.
+    auto copy_all = [&](size_t from, size_t to) {
+        for(int round = 0; round < 100; ++round)
+            for(size_t i = 0; i < names.size(); i += 2)
+                backend.CopyFile(names[i + from], names[i + to], true);
+    };
+
+    std::thread forward (copy_all, 0, 1);
+    std::thread backward(copy_all, 1, 0);
+    forward .join();
+    backward.join();
+
+    EXPECT_EQ(backend.GetFilenames().size(), names.size());
+    for(size_t i = 0; i < names.size(); i += 2)
+        EXPECT_EQ(read(backend, names[i]), read(backend, names[i + 1]));
+}
+
+//------------------------------------------------------------------------------
+TEST(MemoryBackend, RefusesToOverwriteByDefault)
+{
+    MemoryBackend backend;
+    write(backend, "src", "new");
+    write(backend, "dst", "old");
+
+    EXPECT_THROW(backend.CopyFile("src", "dst", false), std::ios::failure);
+    EXPECT_THROW(backend.MoveFile("src", "dst", false), std::ios::failure);
+    EXPECT_EQ(read(backend, "src"), "new");
+    EXPECT_EQ(read(backend, "dst"), "old");
+
+    backend.MoveFile("src", "dst", true);
+    EXPECT_FALSE(backend.IsFile("src"));
+    EXPECT_EQ(read(backend, "dst"), "new");
+}
+
+//------------------------------------------------------------------------------
+TEST(MemoryBackend, ReplaceGoesThroughTheBackend)
+{
+    MemoryBackend backend;
+    ScopedBackend scoped(backend);
+
+    WriteAllText("/mem/dst", "old");
+    WriteAllText("/mem/src", "new");
+
+    Replace("/mem/src", "/mem/dst", "/mem/backup");
+    EXPECT_FALSE(Exist("/mem/src"));
+    EXPECT_EQ(ReadAllText("/mem/dst"),    "new");
+    EXPECT_EQ(ReadAllText("/mem/backup"), "old");
+
+    EXPECT_THROW(Replace("/mem/src", "/mem/dst"), std::runtime_error);
+}
+
+
+//----------------------------------------------------------------------------//
+// OverlayBackend                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(OverlayBackend, WhiteoutHidesTheLowerFile)
+{
+    MemoryBackend  upper, lower;
+    OverlayBackend overlay(upper, lower);
+    write(lower, "file", "lower");
+
+    EXPECT_EQ(read(overlay, "file"), "lower");
+    EXPECT_TRUE(overlay.DeleteFile("file"));
+
+    std::string contents;
+    EXPECT_FALSE(overlay.ReadFile("file", contents));
+    EXPECT_FALSE(overlay.IsFile("file"));
+    EXPECT_EQ   (overlay.GetFileSize("file"), 0u);
+    EXPECT_FALSE(overlay.DeleteFile("file"));
+    EXPECT_EQ   (overlay.GetWhiteouts(), std::vector<std::string> { "file" });
+
+    // The lower one is never modified.
+    EXPECT_EQ(read(lower, "file"), "lower");
+}
+
+//------------------------------------------------------------------------------
+TEST(OverlayBackend, AppendCopiesTheLowerFileUp)
+{
+    MemoryBackend  upper, lower;
+    OverlayBackend overlay(upper, lower);
+    write(lower, "file", "lower");
+
+    overlay.AppendFile("file", "+upper", 6);
+    EXPECT_EQ(read(overlay, "file"), "lower+upper");
+    EXPECT_EQ(read(upper,   "file"), "lower+upper");
+    EXPECT_EQ(read(lower,   "file"), "lower");
+}
+
+//------------------------------------------------------------------------------
+TEST(OverlayBackend, AppendAfterDeleteDoesntCopyUp)
+{
+    MemoryBackend  upper, lower;
+    OverlayBackend overlay(upper, lower);
+    write(lower, "file", "lower");
+
+    overlay.DeleteFile("file");
+    overlay.AppendFile("file", "upper", 5);
+    EXPECT_EQ(read(overlay, "file"), "upper");
+    EXPECT_TRUE(overlay.GetWhiteouts().empty());
+}
+
+//------------------------------------------------------------------------------
+TEST(OverlayBackend, WriteClearsTheWhiteout)
+{
+    MemoryBackend  upper, lower;
+    OverlayBackend overlay(upper, lower);
+    write(lower, "file", "lower");
+
+    overlay.DeleteFile("file");
+    write(overlay, "file", "upper");
+
+    EXPECT_TRUE(overlay.GetWhiteouts().empty());
+    EXPECT_EQ(read(overlay, "file"), "upper");
+
+    // Deleting it again hides the lower one again.
+    EXPECT_TRUE(overlay.DeleteFile("file"));
+    EXPECT_FALSE(overlay.IsFile("file"));
+    EXPECT_EQ(read(lower, "file"), "lower");
+}
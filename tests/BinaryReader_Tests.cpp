@@ -0,0 +1,105 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BinaryReader_Tests.cpp                                        //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// A size prefix followed by only a few bytes of payload.
+static std::string truncated_record(uint64_t claimedSize)
+{
+    std::ostringstream stream;
+    {
+        BinaryWriter writer(stream);
+        writer.WriteVarUInt(claimedSize);
+        writer.WriteBytes("abc", 3);
+        writer.Flush();
+    }
+
+    return stream.str();
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(BinaryReader, BlobsAndStringsRoundTrip)
+{
+    std::vector<byte_t> big(3 * 1024 * 1024 + 5, 0x5A);
+
+    std::stringstream stream;
+    {
+        BinaryWriter writer(stream);
+        writer.WriteString("");
+        writer.WriteString("hello");
+        writer.WriteBlob(big);
+        writer.Flush();
+    }
+
+    BinaryReader reader(stream);
+    EXPECT_EQ(reader.ReadString(), "");
+    EXPECT_EQ(reader.ReadString(), "hello");
+    EXPECT_EQ(reader.ReadBlob(),   big);
+    EXPECT_TRUE(reader.IsEndOfFile());
+}
+
+//------------------------------------------------------------------------------
+TEST(BinaryReader, HugeSizeIsEndOfFileNotBadAlloc)
+{
+    for(auto size : { uint64_t(1) << 40, uint64_t(1) << 62, ~uint64_t(0) })
+    {
+        std::istringstream blob_stream(truncated_record(size));
+        BinaryReader blob_reader(blob_stream);
+        EXPECT_THROW(blob_reader.ReadBlob(), std::runtime_error);
+
+        std::istringstream str_stream(truncated_record(size));
+        BinaryReader str_reader(str_stream);
+        EXPECT_THROW(str_reader.ReadString(), std::runtime_error);
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(BinaryReader, TruncatedRecordReportsEndOfFile)
+{
+    std::istringstream stream(truncated_record(10));
+    BinaryReader reader(stream);
+
+    try {
+        reader.ReadString();
+        FAIL() << "ReadString didn't throw";
+    } catch(const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("end of file"), std::string::npos) << e.what();
+    }
+}
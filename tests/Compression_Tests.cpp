@@ -0,0 +1,426 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Compression_Tests.cpp                                         //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// COWNOTE(n2omatt): Written by lz4(1) with -BD -BX -B4 --content-size,
+//   so it has what our own frames don't: linked blocks (the later ones
+//   reference the previous ones), block checksums and 64KB blocks.
+//   The contents are kLz4CliLine repeated up to kLz4CliSize bytes.
+static const char   *kLz4CliLine = "The quick brown fox jumps over the lazy dog - 0123456789\n";
+static const size_t  kLz4CliSize = 3 * 65536 + 123;
+
+static const size_t kLz4CliSecondBlock = 347; // Offset of its header.
+
+static const unsigned char kLz4CliFrame[] = {
+    0x04, 0x22, 0x4d, 0x18, 0x5c, 0x40, 0x7b, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf9, 0x44, 0x01, 0x00, 0x00, 0xff, 0x2a, 0x54, 0x68, 0x65,
+    0x20, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e,
+    0x20, 0x66, 0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a, 0x79,
+    0x20, 0x64, 0x6f, 0x67, 0x20, 0x2d, 0x20, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x39, 0x0a, 0x39, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaf, 0x50, 0x79, 0x20, 0x64, 0x6f, 0x67, 0x4d, 0xa3, 0x59, 0xad, 0x0a,
+    0x01, 0x00, 0x00, 0x0f, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x50,
+    0x73, 0x20, 0x6f, 0x76, 0x65, 0xc6, 0x7a, 0xae, 0x19, 0x44, 0x01, 0x00,
+    0x00, 0xff, 0x2a, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61, 0x7a,
+    0x79, 0x20, 0x64, 0x6f, 0x67, 0x20, 0x2d, 0x20, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x0a, 0x54, 0x68, 0x65, 0x20, 0x71,
+    0x75, 0x69, 0x63, 0x6b, 0x20, 0x62, 0x72, 0x6f, 0x77, 0x6e, 0x20, 0x66,
+    0x6f, 0x78, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x73, 0x20, 0x6f, 0x76, 0x65,
+    0x39, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x50, 0x62, 0x72, 0x6f, 0x77,
+    0x6e, 0x63, 0x97, 0x93, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0xd5, 0xff,
+    0x63, 0x50, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x96, 0x64, 0xcd, 0x75, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0x07, 0x22, 0xf5,
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static std::string lz4_cli_contents()
+{
+    std::string contents;
+    while(contents.size() < kLz4CliSize)
+        contents.append(kLz4CliLine);
+
+    contents.resize(kLz4CliSize);
+    return contents;
+}
+
+//------------------------------------------------------------------------------
+static std::string lz4_cli_frame()
+{
+    return std::string(
+        reinterpret_cast<const char *>(kLz4CliFrame),
+        sizeof(kLz4CliFrame)
+    );
+}
+
+//------------------------------------------------------------------------------
+static std::string compress(const std::string &contents, Compression compression)
+{
+    Tests::TempDir dir;
+    WriteAllTextCompressed(dir.Path("file"), contents, compression);
+
+    return ReadAllText(dir.Path("file"));
+}
+
+//------------------------------------------------------------------------------
+static std::string skippable_frame(const std::string &payload)
+{
+    std::string frame("\x5A\x2A\x4D\x18", 4); // Magic 0x184D2A5A.
+
+    auto size = uint32_t(payload.size());
+    for(int i = 0; i < 4; ++i)
+        frame.push_back(char((size >> (8 * i)) & 0xFF));
+
+    return frame + payload;
+}
+
+
+//----------------------------------------------------------------------------//
+// Round Trips                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+class CompressionRoundTrip :
+    public ::testing::TestWithParam<std::tuple<Compression, size_t>>
+{
+    // Empty...
+};
+
+//------------------------------------------------------------------------------
+TEST_P(CompressionRoundTrip, ReadsBackWhatWasWritten)
+{
+    auto compression = std::get<0>(GetParam());
+    auto size        = std::get<1>(GetParam());
+
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(size);
+
+    // Half random, half text - So the blocks are compressed and stored.
+    for(size_t i = size / 2; i < size; ++i)
+        data[i] = "CoreFile\n"[i % 9];
+
+    WriteAllBytesCompressed(filename, data.data(), data.size(), compression, 4);
+    EXPECT_EQ(DetectCompression(filename), compression);
+    EXPECT_EQ(ReadAllTextDecompressed(filename), data);
+
+    auto bytes = ReadAllBytesDecompressed(filename);
+    ASSERT_EQ(bytes.size(), data.size());
+    EXPECT_EQ(memcmp(bytes.data(), data.data(), data.size()), 0);
+}
+
+//------------------------------------------------------------------------------
+INSTANTIATE_TEST_CASE_P(
+    Sizes,
+    CompressionRoundTrip,
+    ::testing::Combine(
+    #if COREFILE_ZSTD
+        ::testing::Values(Compression::Lz4, Compression::Zstd),
+    #else
+        ::testing::Values(Compression::Lz4),
+    #endif
+        ::testing::Values(
+            size_t(0),
+            size_t(1),
+            size_t(12),            // Too small for any match.
+            size_t(13),            // The smallest with one.
+            kLz4BlockSize,
+            kLz4BlockSize + 1
+        )
+    )
+);
+
+//------------------------------------------------------------------------------
+TEST(Compression, RoundTripsTheLines)
+{
+    Tests::TempDir dir;
+    auto lines = std::vector<std::string> { "a", "", "ccc" };
+
+    // Same lines of the plain functions - Including the empty last one.
+    WriteAllLines          (dir.Path("plain"), lines);
+    WriteAllLinesCompressed(dir.Path("lz4"),   lines);
+    EXPECT_EQ(ReadAllLinesDecompressed(dir.Path("lz4")), ReadAllLines(dir.Path("plain")));
+}
+
+//------------------------------------------------------------------------------
+TEST(Compression, ReadsPlainFilesAsTheyAre)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(3 * 1024 * 1024 + 5);
+    WriteAllText(filename, data);
+
+    EXPECT_EQ(DetectCompression(filename), Compression::None);
+    EXPECT_EQ(ReadAllTextDecompressed(filename), data);
+
+    WriteAllText(filename, "lz4");
+    EXPECT_EQ(ReadAllTextDecompressed(filename), "lz4");
+}
+
+//------------------------------------------------------------------------------
+TEST(Compression, MissingFilesAreEmpty)
+{
+    Tests::TempDir dir;
+
+    EXPECT_EQ  (DetectCompression(dir.Path("missing")), Compression::None);
+    EXPECT_TRUE(ReadAllTextDecompressed (dir.Path("missing")).empty());
+    EXPECT_TRUE(ReadAllBytesDecompressed(dir.Path("missing")).empty());
+}
+
+//------------------------------------------------------------------------------
+TEST(Compression, DecompressesFromOtherBackends)
+{
+    MemoryBackend backend;
+    ScopedBackend scoped(backend);
+
+    auto data = Tests::MakeData(100 * 1024);
+    WriteAllTextCompressed("/mem/file", data);
+
+    EXPECT_EQ(DetectCompression("/mem/file"), Compression::Lz4);
+    EXPECT_EQ(ReadAllTextDecompressed("/mem/file"), data);
+}
+
+#if !COREFILE_ZSTD
+//------------------------------------------------------------------------------
+TEST(Compression, ZstdNeedsToBeCompiledIn)
+{
+    Tests::TempDir dir;
+    EXPECT_THROW(
+        WriteAllTextCompressed(dir.Path("file"), "data", Compression::Zstd),
+        std::invalid_argument
+    );
+}
+#endif // !COREFILE_ZSTD
+
+
+//----------------------------------------------------------------------------//
+// Frames                                                                     //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(Compression, ReadsFramesOfTheLz4Tool)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("file"), lz4_cli_frame());
+
+    EXPECT_EQ(ReadAllTextDecompressed(dir.Path("file")), lz4_cli_contents());
+}
+
+//------------------------------------------------------------------------------
+TEST(Compression, ReadsConcatenatedFrames)
+{
+    Tests::TempDir dir;
+    auto a = Tests::MakeData(1000);
+    auto b = std::string(5000, 'b');
+
+    auto frames = compress(a, Compression::Lz4)
+        + lz4_cli_frame()
+        + compress(b, Compression::Lz4);
+
+    WriteAllText(dir.Path("file"), frames);
+    EXPECT_EQ(ReadAllTextDecompressed(dir.Path("file")), a + lz4_cli_contents() + b);
+}
+
+#if COREFILE_ZSTD
+//------------------------------------------------------------------------------
+TEST(Compression, ReadsConcatenatedZstdFrames)
+{
+    Tests::TempDir dir;
+    auto a = Tests::MakeData(1000);
+    auto b = std::string(5000, 'b');
+
+    auto frames = skippable_frame("meta")
+        + compress(a, Compression::Zstd)
+        + compress(b, Compression::Zstd);
+
+    WriteAllText(dir.Path("file"), frames);
+    EXPECT_EQ(DetectCompression(dir.Path("file")), Compression::Zstd);
+    EXPECT_EQ(ReadAllTextDecompressed(dir.Path("file")), a + b);
+
+    WriteAllText(dir.Path("file"), frames.substr(0, frames.size() - 3));
+    EXPECT_THROW(ReadAllTextDecompressed(dir.Path("file")), std::runtime_error);
+}
+#endif // COREFILE_ZSTD
+
+//------------------------------------------------------------------------------
+TEST(Compression, SkipsSkippableFrames)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(1000);
+    auto frame    = compress(data, Compression::Lz4);
+
+    auto frames = skippable_frame("meta")
+        + frame
+        + skippable_frame("")
+        + frame
+        + skippable_frame("end");
+
+    WriteAllText(filename, frames);
+    EXPECT_EQ(DetectCompression(filename), Compression::Lz4);
+    EXPECT_EQ(ReadAllTextDecompressed(filename), data + data);
+
+    // Only skippable frames - Nothing says it's compressed.
+    auto skippable = skippable_frame("meta");
+    EXPECT_EQ(DetectCompression(skippable.data(), skippable.size()), Compression::None);
+}
+
+
+//----------------------------------------------------------------------------//
+// Corruption                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(Compression, ThrowsOnCorruptedChecksums)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    // Content checksum - The last 4 bytes of our frames.
+    auto frame = compress(Tests::MakeData(1000), Compression::Lz4);
+    frame.back() ^= 0x01;
+    WriteAllText(filename, frame);
+    EXPECT_THROW(ReadAllTextDecompressed(filename), std::runtime_error);
+
+    // Header checksum.
+    frame = compress(Tests::MakeData(1000), Compression::Lz4);
+    frame[14] ^= 0x01;
+    WriteAllText(filename, frame);
+    EXPECT_THROW(ReadAllTextDecompressed(filename), std::runtime_error);
+
+    // Block checksum - A byte in the middle of the second block.
+    frame = lz4_cli_frame();
+    frame[kLz4CliSecondBlock + 100] ^= 0x01;
+    WriteAllText(filename, frame);
+    EXPECT_THROW(ReadAllTextDecompressed(filename), std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+TEST(Compression, ThrowsOnTruncatedFrames)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = std::string(100 * 1024, 'x') + Tests::MakeData(1000);
+    auto frame    = compress(data, Compression::Lz4);
+
+    // Within the header, a block, the end mark and the checksum.
+    for(auto cut : { size_t(6), size_t(30), frame.size() - 6, frame.size() - 2 })
+    {
+        WriteAllText(filename, frame.substr(0, cut));
+        EXPECT_THROW(ReadAllTextDecompressed(filename), std::runtime_error) << "cut: " << cut;
+    }
+
+    // A block whose size is larger than the data that is left.
+    WriteAllText(filename, lz4_cli_frame().substr(0, kLz4CliSecondBlock + 10));
+    EXPECT_THROW(ReadAllTextDecompressed(filename), std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+TEST(Compression, ThrowsOnGarbageAfterAFrame)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    WriteAllText(filename, compress("data", Compression::Lz4) + "garbage");
+    EXPECT_THROW(ReadAllTextDecompressed(filename), std::runtime_error);
+}
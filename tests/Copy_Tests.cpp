@@ -0,0 +1,221 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Copy_Tests.cpp                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cerrno>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+static const size_t kFileSize = 3 * 1024 * 1024 + 17;
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(Copy, CopiesTheContents)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(kFileSize);
+    WriteAllText(dir.Path("src"), data);
+
+    Copy(dir.Path("src"), dir.Path("dst"));
+    EXPECT_EQ(ReadAllText(dir.Path("dst")), data);
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, FallsBackToSendfileWhenCopyFileRangeIsUnsupported)
+{
+    for(auto error : { EXDEV, ENOSYS, EINVAL, EOPNOTSUPP })
+    {
+        Tests::TempDir dir;
+        auto data = Tests::MakeData(kFileSize);
+        WriteAllText(dir.Path("src"), data);
+
+        {
+            Shim::ScopedShim shim;
+            shim.Fail(Call::Ioctl,         EOPNOTSUPP); // No reflink.
+            shim.Fail(Call::CopyFileRange, error);
+
+            Copy(dir.Path("src"), dir.Path("dst"));
+
+            EXPECT_EQ(shim.GetCount(Call::CopyFileRange), 1u) << strerror(error);
+            EXPECT_GT(shim.GetCount(Call::Sendfile),      0u) << strerror(error);
+            EXPECT_EQ(shim.GetCount(Call::Read),          0u) << strerror(error);
+        }
+
+        EXPECT_EQ(ReadAllText(dir.Path("dst")), data) << strerror(error);
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, FallsBackToTheBufferedLoopWithShortWrites)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(kFileSize);
+    WriteAllText(dir.Path("src"), data);
+
+    {
+        Shim::ScopedShim shim;
+        shim.Fail     (Call::Ioctl,         EOPNOTSUPP);
+        shim.Fail     (Call::CopyFileRange, ENOSYS);
+        shim.Fail     (Call::Sendfile,      EINVAL);
+        shim.Limit    (Call::Write,         4096 + 3);
+        shim.Interrupt(Call::Write,         2);
+        shim.Interrupt(Call::Read,          2);
+
+        Copy(dir.Path("src"), dir.Path("dst"));
+
+        EXPECT_GE(shim.GetCount(Call::Write), kFileSize / (4096 + 3));
+    }
+
+    EXPECT_EQ(ReadAllText(dir.Path("dst")), data);
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, KeepsTheProgressOfAnInterruptedKernelCopy)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(kFileSize);
+    WriteAllText(dir.Path("src"), data);
+
+    {
+        Shim::ScopedShim shim;
+        shim.Fail     (Call::Ioctl,         EOPNOTSUPP);
+        shim.Limit    (Call::CopyFileRange, 64 * 1024);
+        shim.Interrupt(Call::CopyFileRange, 1);
+
+        Copy(dir.Path("src"), dir.Path("dst"));
+    }
+
+    EXPECT_EQ(ReadAllText(dir.Path("dst")), data);
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, CopiesFilesThatReportSizeZero)
+{
+    Tests::TempDir dir;
+
+    // procfs reports 0 - Newer kernels refuse copy_file_range(2) with
+    // EXDEV, older ones return 0 right away (and so may sendfile(2)).
+    for(auto call : { Call::CopyFileRange, Call::Sendfile })
+    {
+        Shim::ScopedShim shim;
+        shim.Eof(Call::CopyFileRange);
+        if(call == Call::Sendfile)
+            shim.Eof(Call::Sendfile);
+
+        Copy("/proc/self/status", dir.Path("status"), true);
+
+        auto contents = ReadAllText(dir.Path("status"));
+        EXPECT_EQ(contents.compare(0, 5, "Name:"), 0);
+    }
+
+    Copy("/proc/self/status", dir.Path("status"), true);
+    EXPECT_EQ(ReadAllText(dir.Path("status")).compare(0, 5, "Name:"), 0);
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, CopiesEmptyFiles)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("src"), "");
+
+    Copy(dir.Path("src"), dir.Path("dst"));
+    EXPECT_TRUE (Exist(dir.Path("dst")));
+    EXPECT_EQ   (GetSize(dir.Path("dst")), 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, ThrowsOnRealErrors)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("src"), Tests::MakeData(4096));
+
+    Shim::ScopedShim shim;
+    shim.Fail(Call::Ioctl,         EOPNOTSUPP);
+    shim.Fail(Call::CopyFileRange, EIO);
+
+    EXPECT_THROW(Copy(dir.Path("src"), dir.Path("dst")), std::runtime_error);
+}
+
+//------------------------------------------------------------------------------
+TEST(Copy, RefusesToOverwriteByDefault)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("src"), "src");
+    WriteAllText(dir.Path("dst"), "dst");
+
+    EXPECT_THROW(Copy(dir.Path("src"), dir.Path("dst")), std::ios::failure);
+    EXPECT_EQ   (ReadAllText(dir.Path("dst")), "dst");
+
+    Copy(dir.Path("src"), dir.Path("dst"), true);
+    EXPECT_EQ(ReadAllText(dir.Path("dst")), "src");
+}
+
+//------------------------------------------------------------------------------
+TEST(CopyMany, WorkersUseTheCallersBackend)
+{
+    MemoryBackend backend;
+    ScopedBackend scoped(backend);
+
+    std::vector<BulkJob> jobs;
+    auto bytes_total = uint64_t(0);
+    for(size_t i = 0; i < 8; ++i)
+    {
+        auto src = "/mem/src_" + std::to_string(i);
+        WriteAllText(src, Tests::MakeData(1024 * (i + 1)));
+        bytes_total += 1024 * (i + 1);
+
+        BulkJob job;
+        job.src = src;
+        job.dst = "/mem/dst_" + std::to_string(i);
+        jobs.push_back(job);
+    }
+
+    // With progress every job runs on a pool thread.
+    BulkProgress last;
+    auto errors = CopyMany(jobs, false, [&](const BulkProgress &progress) {
+        last = progress;
+    }, 4);
+
+    for(size_t i = 0; i < jobs.size(); ++i)
+    {
+        EXPECT_TRUE(errors[i].empty()) << errors[i];
+        EXPECT_EQ(ReadAllText(jobs[i].dst), ReadAllText(jobs[i].src));
+    }
+    EXPECT_EQ(last.filesDone,   jobs.size());
+    EXPECT_EQ(last.filesFailed, 0u);
+    EXPECT_EQ(last.bytesTotal,  bytes_total);
+    EXPECT_EQ(last.bytesDone,   bytes_total);
+}
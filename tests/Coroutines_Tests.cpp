@@ -0,0 +1,174 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Coroutines_Tests.cpp                                          //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Awaiting the coroutine ReadAll* / WriteAll* - Built as C++20.           //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstring>
+#include <ios>
+#include <string>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+#if defined(COW_COREFILE_HAS_COROUTINES)
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static std::vector<byte_t> to_bytes(const std::string &str)
+{
+    return std::vector<byte_t>(str.begin(), str.end());
+}
+
+//------------------------------------------------------------------------------
+// Awaits the write and the read back from inside another coroutine.
+static Task<std::string> write_and_read_back(
+    std::string filename,
+    std::string contents)
+{
+    co_await WriteAllTextAsync(filename, contents);
+    co_return co_await ReadAllTextAsync(filename);
+}
+
+//------------------------------------------------------------------------------
+static Task<bool> read_missing_throws(std::string filename)
+{
+    try {
+        co_await ReadAllBytesAsync(filename);
+    } catch(const std::ios::failure &) {
+        co_return true;
+    }
+    co_return false;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(Coroutines, ReadAllMatchesTheSyncVersions)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    for(auto size : { size_t(0), size_t(1), size_t(4096), size_t(3 * 1024 * 1024 + 5) })
+    {
+        auto data = Tests::MakeData(size);
+        WriteAllText(filename, data);
+
+        EXPECT_EQ(SyncWait(ReadAllTextAsync (filename)), ReadAllText (filename));
+        EXPECT_EQ(SyncWait(ReadAllBytesAsync(filename)), ReadAllBytes(filename));
+        EXPECT_EQ(SyncWait(ReadAllTextAsync (filename)).size(), size);
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(Coroutines, WriteAllIsReadBackBySyncVersions)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(1024 * 1024 + 1);
+
+    SyncWait(WriteAllBytesAsync(filename, to_bytes(data)));
+    EXPECT_EQ(ReadAllText(filename), data);
+
+    // Truncates the previous, longer, contents.
+    SyncWait(WriteAllTextAsync(filename, "short"));
+    EXPECT_EQ(ReadAllText(filename), "short");
+
+    SyncWait(WriteAllTextAsync(filename, ""));
+    EXPECT_EQ(ReadAllText(filename), "");
+}
+
+//------------------------------------------------------------------------------
+TEST(Coroutines, AwaitsFromAnotherCoroutine)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(100000);
+
+    EXPECT_EQ(SyncWait(write_and_read_back(dir.Path("file"), data)), data);
+}
+
+//------------------------------------------------------------------------------
+TEST(Coroutines, ReadLinesFollowsTheLineReaderRules)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "a\r\n\nccc");
+
+    auto read_lines = [](std::string filename) -> Task<std::vector<std::string>> {
+        std::vector<std::string> lines;
+
+        auto gen = ReadLinesAsync(filename, 2);
+        while(co_await gen.Next())
+            lines.emplace_back(gen.Value());
+
+        co_return lines;
+    };
+
+    auto expected = std::vector<std::string> { "a\r", "", "ccc" };
+    EXPECT_EQ(SyncWait(read_lines(filename)), expected);
+}
+
+//------------------------------------------------------------------------------
+TEST(Coroutines, ReadAllOfAMissingFileThrows)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("missing");
+
+    // The sync versions return empty instead.
+    EXPECT_TRUE(ReadAllBytes(filename).empty());
+    EXPECT_TRUE(ReadAllText (filename).empty());
+
+    EXPECT_THROW(SyncWait(ReadAllBytesAsync(filename)), std::ios::failure);
+    EXPECT_THROW(SyncWait(ReadAllTextAsync (filename)), std::ios::failure);
+    EXPECT_TRUE (SyncWait(read_missing_throws(filename)));
+}
+
+//------------------------------------------------------------------------------
+TEST(Coroutines, WriteAllToAMissingDirectoryThrows)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("no/such/file");
+
+    EXPECT_THROW(SyncWait(WriteAllTextAsync(filename, "x")), std::ios::failure);
+    EXPECT_THROW(
+        SyncWait(WriteAllBytesAsync(filename, to_bytes("x"))),
+        std::ios::failure
+    );
+}
+
+#else // !COW_COREFILE_HAS_COROUTINES
+
+//------------------------------------------------------------------------------
+TEST(Coroutines, NotSupportedByTheCompiler)
+{
+    GTEST_SKIP() << "C++20 mode without coroutine support";
+}
+
+#endif // COW_COREFILE_HAS_COROUTINES
@@ -0,0 +1,205 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DirectIO_Tests.cpp                                            //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Direct I/O round trips, tail padding and the buffered fallback.         //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cerrno>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <tuple>
+#include <vector>
+// POSIX
+#include <sys/stat.h>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static uint64_t file_size(const std::string &filename)
+{
+    struct stat st;
+    if(stat(filename.c_str(), &st) != 0)
+        return uint64_t(-1);
+
+    return uint64_t(st.st_size);
+}
+
+//------------------------------------------------------------------------------
+static std::string read_direct(
+    const std::string &filename,
+    AlignedBufferPool &pool)
+{
+    std::string data;
+    ReadDirect(
+        filename,
+        [&data](uint64_t offset, const byte_t *pData, size_t size) {
+            EXPECT_EQ(offset, data.size());
+            data.append(reinterpret_cast<const char *>(pData), size);
+        },
+        pool
+    );
+
+    return data;
+}
+
+
+//----------------------------------------------------------------------------//
+// Round Trips                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// The pool buffer size and the file size.
+class DirectIORoundTrip :
+    public ::testing::TestWithParam<std::tuple<size_t, size_t>>
+{
+    // Empty...
+};
+
+//------------------------------------------------------------------------------
+TEST_P(DirectIORoundTrip, KeepsTheExactSize)
+{
+    auto buffer_size = std::get<0>(GetParam());
+    auto size        = std::get<1>(GetParam());
+
+    Tests::TempDir    dir;
+    AlignedBufferPool pool(buffer_size);
+
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(size);
+
+    // Longer than any of the sizes - O_TRUNC must cut it.
+    WriteAllText(filename, Tests::MakeData(4 * 1024 * 1024));
+
+    WriteAllBytesDirect(filename, data.data(), data.size(), pool);
+    EXPECT_EQ(file_size(filename), size);
+    EXPECT_EQ(ReadAllText(filename), data);
+
+    auto bytes = ReadAllBytesDirect(filename, pool);
+    ASSERT_EQ(bytes.size(), data.size());
+    EXPECT_EQ(memcmp(bytes.data(), data.data(), data.size()), 0);
+
+    EXPECT_EQ(read_direct(filename, pool), data);
+}
+
+//------------------------------------------------------------------------------
+INSTANTIATE_TEST_CASE_P(
+    Sizes,
+    DirectIORoundTrip,
+    ::testing::Combine(
+        ::testing::Values(
+            kDirectIOAlignment * 2,    // Many buffers per file.
+            kDirectIODefaultBufferSize
+        ),
+        ::testing::Values(
+            size_t(0),
+            size_t(1),
+            kDirectIOAlignment - 1,
+            kDirectIOAlignment,
+            kDirectIOAlignment + 1,
+            size_t(1024 * 1024 + 1),
+            size_t(3145733)            // 3 MiB + 5.
+        )
+    )
+);
+
+
+//----------------------------------------------------------------------------//
+// Buffered Fallback                                                          //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(DirectIO, FallsBackToBufferedWhenODirectIsRefused)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(kDirectIOAlignment + 1);
+
+    {
+        Shim::ScopedShim shim;
+        shim.FailFirst(Call::Open, EINVAL, 1);
+
+        WriteAllBytesDirect(filename, data.data(), data.size());
+        EXPECT_EQ(shim.GetCount(Call::Open), 2u);
+    }
+    EXPECT_EQ(file_size(filename), data.size());
+    EXPECT_EQ(ReadAllText(filename), data);
+
+    {
+        Shim::ScopedShim shim;
+        shim.FailFirst(Call::Open, EINVAL, 1);
+
+        auto bytes = ReadAllBytesDirect(filename);
+        EXPECT_EQ(shim.GetCount(Call::Open), 2u);
+        ASSERT_EQ(bytes.size(), data.size());
+        EXPECT_EQ(memcmp(bytes.data(), data.data(), data.size()), 0);
+    }
+
+    {
+        Shim::ScopedShim shim;
+        shim.FailFirst(Call::Open, EINVAL, 1);
+
+        EXPECT_EQ(read_direct(filename, AlignedBufferPool::GetDefault()), data);
+        EXPECT_EQ(shim.GetCount(Call::Open), 2u);
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(DirectIO, FallsBackOnAnyErrorAndReportsTheRealOne)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("missing");
+
+    Shim::ScopedShim shim;
+    EXPECT_THROW(ReadAllBytesDirect(filename), std::ios::failure);
+    EXPECT_EQ(shim.GetCount(Call::Open), 2u);
+
+    shim.ResetCounts();
+    EXPECT_THROW(
+        WriteAllBytesDirect(dir.Path("no/such/dir"), "x", 1),
+        std::ios::failure
+    );
+    EXPECT_EQ(shim.GetCount(Call::Open), 2u);
+}
+
+//------------------------------------------------------------------------------
+TEST(DirectIO, RetriesInterruptedReads)
+{
+    Tests::TempDir    dir;
+    AlignedBufferPool pool(kDirectIOAlignment);
+
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(3 * kDirectIOAlignment + 7);
+    WriteAllBytesDirect(filename, data.data(), data.size(), pool);
+
+    Shim::ScopedShim shim;
+    shim.Interrupt(Call::Pread, 3);
+
+    EXPECT_EQ(read_direct(filename, pool), data);
+}
@@ -0,0 +1,213 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileCache_Tests.cpp                                           //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <string>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(FileCache, InvalidateDropsTheEntry)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "old");
+
+    FileCache cache(1024, 1, FileCache::Validation::None);
+    EXPECT_EQ(*cache.Get(filename), "old");
+
+    WriteAllText(filename, "new");
+    EXPECT_EQ(*cache.Get(filename), "old");
+
+    cache.Invalidate(filename);
+    EXPECT_EQ(*cache.Get(filename), "new");
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits,   1u);
+    EXPECT_EQ(stats.misses, 2u);
+}
+
+//------------------------------------------------------------------------------
+// COWNOTE(n2omatt): The file is replaced and invalidated while Get
+//   reads it - Get's descriptor still sees the old inode, so what it
+//   read is stale and must not be cached (with Validation::None nothing
+//   would ever evict it).
+TEST(FileCache, InvalidateDuringGetIsNotLost)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "old");
+
+    FileCache cache(1024, 1, FileCache::Validation::None);
+    {
+        Shim::ScopedShim shim;
+        shim.Before(Call::Pread, [&]() {
+            WriteAllText(filename, "new", WriteMode::Atomic);
+            cache.Invalidate(filename);
+        });
+
+        EXPECT_EQ(*cache.Get(filename), "old");
+    }
+
+    EXPECT_EQ(cache.GetStats().entries, 0u);
+    EXPECT_EQ(*cache.Get(filename), "new");
+    EXPECT_EQ(*cache.Get(filename), "new");
+}
+
+//------------------------------------------------------------------------------
+TEST(FileCache, ClearDuringGetIsNotLost)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "old");
+
+    FileCache cache(1024, 1, FileCache::Validation::None);
+    {
+        Shim::ScopedShim shim;
+        shim.Before(Call::Pread, [&]() {
+            WriteAllText(filename, "new", WriteMode::Atomic);
+            cache.Clear();
+        });
+
+        EXPECT_EQ(*cache.Get(filename), "old");
+    }
+
+    EXPECT_EQ(*cache.Get(filename), "new");
+}
+
+//------------------------------------------------------------------------------
+TEST(FileCache, StatRevalidatesTheEntry)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "old");
+
+    FileCache cache(1024, 1, FileCache::Validation::Stat);
+    EXPECT_EQ(*cache.Get(filename), "old");
+    EXPECT_EQ(*cache.Get(filename), "old");
+
+    WriteAllText(filename, "newer");
+    EXPECT_EQ(*cache.Get(filename), "newer");
+
+    // Gone - The entry goes with it.
+    Delete(filename);
+    EXPECT_TRUE(cache.Get(filename)->empty());
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits,          1u);
+    EXPECT_EQ(stats.misses,        3u);
+    EXPECT_EQ(stats.invalidations, 2u);
+    EXPECT_EQ(stats.entries,       0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileCache, EvictsTheLeastRecentlyUsed)
+{
+    Tests::TempDir dir;
+    auto data  = Tests::MakeData(100);
+    auto entry = data.size() + dir.Path("a").size(); // Bytes of each entry.
+    for(auto name : { "a", "b", "c", "d" })
+        WriteAllText(dir.Path(name), data);
+
+    FileCache cache(3 * entry, 1);
+    cache.Get(dir.Path("a"));
+    cache.Get(dir.Path("b"));
+    cache.Get(dir.Path("c"));
+    cache.Get(dir.Path("a")); // b is the least recently used now.
+    cache.Get(dir.Path("d"));
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entries,   3u);
+    EXPECT_EQ(stats.bytes,     3 * entry);
+
+    // a, c and d are still there, b must be read again.
+    cache.Get(dir.Path("a"));
+    cache.Get(dir.Path("c"));
+    cache.Get(dir.Path("d"));
+    EXPECT_EQ(cache.GetStats().hits, 4u);
+
+    cache.Get(dir.Path("b"));
+    stats = cache.GetStats();
+    EXPECT_EQ(stats.hits,      4u);
+    EXPECT_EQ(stats.misses,    5u);
+    EXPECT_EQ(stats.evictions, 2u);
+    EXPECT_LE(stats.bytes,     cache.GetByteBudget());
+}
+
+//------------------------------------------------------------------------------
+TEST(FileCache, DoesntCacheFilesBiggerThanTheBudget)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(4096);
+    WriteAllText(filename, data);
+
+    FileCache cache(1024, 1);
+    EXPECT_EQ(*cache.Get(filename), data);
+    EXPECT_EQ(*cache.Get(filename), data);
+
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.hits,    0u);
+    EXPECT_EQ(stats.misses,  2u);
+    EXPECT_EQ(stats.entries, 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileCache, ReadsFilesThatReportSizeZero)
+{
+    FileCache cache;
+
+    auto content = cache.Get("/proc/self/status");
+    ASSERT_FALSE(content->empty());
+    EXPECT_EQ(content->compare(0, 5, "Name:"), 0);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileCache, RetriesInterruptedOpensAndShortReads)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    auto data     = Tests::MakeData(10000);
+    WriteAllText(filename, data);
+
+    FileCache cache;
+    {
+        Shim::ScopedShim shim;
+        shim.Interrupt(Call::Open,  2);
+        shim.Limit    (Call::Pread, 1000);
+
+        EXPECT_EQ(*cache.Get(filename), data);
+        EXPECT_EQ(shim.GetCount(Call::Open), 3u);
+    }
+}
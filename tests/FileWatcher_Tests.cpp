@@ -0,0 +1,239 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FileWatcher_Tests.cpp                                         //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+// POSIX
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Event = FileWatcher::Event;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+static const auto kDebounce = std::chrono::milliseconds(20);
+static const auto kSettle   = std::chrono::milliseconds(400);
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+typedef std::vector<std::pair<std::string, Event>> EventList;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static FileWatcher::Callback record(EventList &events)
+{
+    return [&events](const std::string &filename, Event event) {
+        events.emplace_back(filename, event);
+    };
+}
+
+//------------------------------------------------------------------------------
+// Runs the watcher on the calling thread for the given time - The same
+// way that a caller's event loop would.
+static void pump(FileWatcher &watcher, std::chrono::milliseconds duration)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    auto end = Clock::now() + duration;
+    while(true)
+    {
+        auto now = Clock::now();
+        if(now >= end)
+            break;
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(end - now);
+        auto timeout   = watcher.GetTimeout();
+        if(timeout < 0 || timeout > remaining.count())
+            timeout = static_cast<int>(remaining.count());
+
+        struct pollfd fd = { watcher.GetFd(), POLLIN, 0 };
+        poll(&fd, 1, timeout);
+
+        watcher.Process();
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(FileWatcher, DebouncesABurstIntoOneEvent)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "0");
+
+    EventList   events;
+    FileWatcher watcher(record(events), std::chrono::milliseconds(200));
+    watcher.Watch(filename);
+
+    for(int i = 0; i < 5; ++i)
+        AppendAllText(filename, std::to_string(i));
+
+    // Still within the debounce interval.
+    EXPECT_EQ(watcher.Process(), 0);
+    EXPECT_GT(watcher.GetTimeout(), 0);
+
+    pump(watcher, kSettle + std::chrono::milliseconds(200));
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].first,  filename);
+    EXPECT_EQ(events[0].second, Event::Modified);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileWatcher, ModifiedDoesntHideCreated)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    EventList   events;
+    FileWatcher watcher(record(events), kDebounce);
+    watcher.Watch(filename);
+
+    WriteAllText (filename, "a");
+    AppendAllText(filename, "b");
+
+    pump(watcher, kSettle);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].second, Event::Created);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileWatcher, DeliversTheLastEventOfTheBurst)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "a");
+
+    EventList   events;
+    FileWatcher watcher(record(events), kDebounce);
+    watcher.Watch(filename);
+
+    AppendAllText(filename, "b");
+    Delete(filename);
+
+    pump(watcher, kSettle);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].second, Event::Deleted);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileWatcher, UnwatchStopsTheEvents)
+{
+    Tests::TempDir dir;
+    auto watched   = dir.Path("watched");
+    auto unwatched = dir.Path("unwatched");
+
+    EventList   events;
+    FileWatcher watcher(record(events), kDebounce);
+    watcher.Watch(watched);
+    watcher.Watch(unwatched);
+    watcher.Unwatch(unwatched);
+
+    WriteAllText(watched,   "a");
+    WriteAllText(unwatched, "a");
+
+    pump(watcher, kSettle);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].first, watched);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileWatcher, SeesAtomicReplaces)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "old");
+
+    EventList   events;
+    FileWatcher watcher(record(events), kDebounce);
+    watcher.Watch(filename);
+
+    // A rename over the file - The file itself is never written.
+    WriteAllText(filename, "new", WriteMode::Atomic);
+
+    pump(watcher, kSettle);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].first,  filename);
+    EXPECT_EQ(events[0].second, Event::Created);
+}
+
+//------------------------------------------------------------------------------
+TEST(FileWatcher, RearmsARecreatedDirectory)
+{
+    Tests::TempDir dir;
+    auto dirname  = dir.Path("sub");
+    auto filename = dirname + "/file";
+    ASSERT_EQ(mkdir(dirname.c_str(), 0755), 0);
+    WriteAllText(filename, "old");
+
+    FileCache cache(1024, 1, FileCache::Validation::None);
+    EXPECT_EQ(*cache.Get(filename), "old");
+
+    EventList events;
+    auto invalidate = FileWatcher::InvalidateCache(cache);
+    FileWatcher watcher([&](const std::string &name, Event event) {
+        events.emplace_back(name, event);
+        invalidate(name, event);
+    }, kDebounce);
+    watcher.Watch(filename);
+
+    Delete(filename);
+    ASSERT_EQ(rmdir(dirname.c_str()), 0);
+
+    pump(watcher, kSettle);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].second, Event::Deleted);
+
+    // Back - Written both before and after the watch is re-armed.
+    ASSERT_EQ(mkdir(dirname.c_str(), 0755), 0);
+    WriteAllText(filename, "new");
+    pump(watcher, FileWatcher::kRearmInterval + kSettle);
+    AppendAllText(filename, "er");
+    pump(watcher, kSettle);
+
+    ASSERT_GE(events.size(), 2u);
+    EXPECT_EQ(events[1].second, Event::Created);
+    EXPECT_EQ(events.back().first, filename);
+    EXPECT_EQ(*cache.Get(filename), "newer");
+
+    // Nothing left to re-arm.
+    EXPECT_EQ(watcher.GetTimeout(), -1);
+}
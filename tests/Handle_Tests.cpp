@@ -0,0 +1,265 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Handle_Tests.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Positional and vectored Handle I/O with short transfers and EINTR.      //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+// POSIX
+#include <sys/uio.h>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Splits data in count iovecs of (almost) the same size.
+static std::vector<iovec> split(std::string &data, size_t count)
+{
+    std::vector<iovec> iov;
+
+    auto chunk = data.size() / count;
+    for(size_t i = 0; i < count; ++i)
+    {
+        auto size = (i + 1 == count) ? data.size() - i * chunk : chunk;
+
+        iovec entry;
+        entry.iov_base = &data[i * chunk];
+        entry.iov_len  = size;
+        iov.push_back(entry);
+    }
+
+    return iov;
+}
+
+
+//----------------------------------------------------------------------------//
+// Fixture                                                                    //
+//----------------------------------------------------------------------------//
+class HandleTests :
+    public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_filename = m_dir.Path("file");
+        m_data     = Tests::MakeData(64 * 1024);
+    }
+
+    Handle OpenForWrite()
+    {
+        return Handle(m_filename, OpenMode::kWrite);
+    }
+
+    Handle OpenForRead()
+    {
+        return Handle(m_filename, OpenMode::kRead);
+    }
+
+protected:
+    Tests::TempDir m_dir;
+    std::string    m_filename;
+    std::string    m_data;
+};
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, WriteAndReadWithShortTransfers)
+{
+    {
+        auto handle = OpenForWrite();
+
+        Shim::ScopedShim shim;
+        shim.Limit    (Call::Write, 1000);
+        shim.Interrupt(Call::Write, 3);
+
+        handle.Write(m_data.data(), m_data.size());
+        EXPECT_EQ(shim.GetCount(Call::Write), 3 + (m_data.size() + 999) / 1000);
+    }
+
+    auto handle = OpenForRead();
+    std::string read(m_data.size() + 10, '\0');
+    {
+        Shim::ScopedShim shim;
+        shim.Limit    (Call::Read, 1000);
+        shim.Interrupt(Call::Read, 2);
+
+        EXPECT_EQ(handle.Read(&read[0], read.size()), m_data.size());
+    }
+    read.resize(m_data.size());
+    EXPECT_EQ(read, m_data);
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, PositionalWithShortTransfers)
+{
+    {
+        auto handle = OpenForWrite();
+
+        Shim::ScopedShim shim;
+        shim.Limit    (Call::Pwrite, 1000);
+        shim.Interrupt(Call::Pwrite, 2);
+
+        // Back to front, so each write lands at its own offset.
+        auto half = m_data.size() / 2;
+        handle.WriteAt(&m_data[half], m_data.size() - half, half);
+        handle.WriteAt(&m_data[0],    half,                 0);
+
+        // The position isn't used nor changed.
+        EXPECT_EQ(handle.Seek(0, SEEK_CUR), 0u);
+    }
+    EXPECT_EQ(ReadAllText(m_filename), m_data);
+
+    auto handle = OpenForRead();
+    std::string read(100, '\0');
+    {
+        Shim::ScopedShim shim;
+        shim.Limit    (Call::Pread, 7);
+        shim.Interrupt(Call::Pread, 2);
+
+        EXPECT_EQ(handle.ReadAt(&read[0], read.size(), 5000), read.size());
+    }
+    EXPECT_EQ(read, m_data.substr(5000, 100));
+
+    // Past the end only what's there is read.
+    EXPECT_EQ(handle.ReadAt(&read[0], read.size(), m_data.size() - 10), 10u);
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, VectoredWriteResumesShortWrites)
+{
+    auto data = m_data;
+    auto iov  = split(data, 16);
+    {
+        auto handle = OpenForWrite();
+
+        Shim::ScopedShim shim;
+        shim.Limit    (Call::Writev, 1500);
+        shim.Interrupt(Call::Writev, 2);
+
+        handle.WriteV(iov.data(), static_cast<int>(iov.size()));
+    }
+    EXPECT_EQ(ReadAllText(m_filename), m_data);
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, PositionalVectoredWriteResumesShortWrites)
+{
+    WriteAllText(m_filename, std::string(100, 'x'));
+
+    auto data = m_data;
+    auto iov  = split(data, 16);
+    {
+        Handle handle(m_filename, OpenMode::kReadWrite);
+
+        Shim::ScopedShim shim;
+        shim.Limit    (Call::Pwritev, 1500);
+        shim.Interrupt(Call::Pwritev, 2);
+
+        handle.WriteVAt(iov.data(), static_cast<int>(iov.size()), 100);
+        EXPECT_EQ(handle.Seek(0, SEEK_CUR), 0u);
+    }
+    EXPECT_EQ(ReadAllText(m_filename), std::string(100, 'x') + m_data);
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, VectoredWriteOfMoreThanIovMaxBuffers)
+{
+    auto data = Tests::MakeData(IOV_MAX * 3 + 17);
+    auto iov  = split(data, IOV_MAX * 3 + 17);
+    {
+        auto handle = OpenForWrite();
+
+        Shim::ScopedShim shim;
+        handle.WriteV(iov.data(), static_cast<int>(iov.size()));
+        EXPECT_EQ(shim.GetCount(Call::Writev), 4u);
+    }
+    EXPECT_EQ(ReadAllText(m_filename), data);
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, VectoredReads)
+{
+    WriteAllText(m_filename, m_data);
+
+    std::string read(m_data.size(), '\0');
+    auto iov = split(read, 4);
+
+    auto handle = OpenForRead();
+    {
+        Shim::ScopedShim shim;
+        shim.Interrupt(Call::Readv, 1);
+
+        EXPECT_EQ(handle.ReadV(iov.data(), 4), m_data.size());
+        EXPECT_EQ(shim.GetCount(Call::Readv), 2u);
+    }
+    EXPECT_EQ(read, m_data);
+
+    read.assign(read.size(), '\0');
+    {
+        Shim::ScopedShim shim;
+        shim.Interrupt(Call::Preadv, 1);
+
+        EXPECT_EQ(handle.ReadVAt(iov.data(), 2, 0), m_data.size() / 2);
+    }
+    EXPECT_EQ(read.substr(0, m_data.size() / 2), m_data.substr(0, m_data.size() / 2));
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, ErrorsNameTheDescriptor)
+{
+    auto handle = OpenForWrite();
+
+    Shim::ScopedShim shim;
+    shim.Fail(Call::Pwrite, ENOSPC);
+
+    try {
+        handle.WriteAt("x", 1, 0);
+        FAIL() << "WriteAt didn't throw";
+    } catch(const std::runtime_error &e) {
+        auto expected = "fd " + std::to_string(handle.GetFd());
+        EXPECT_NE(std::string(e.what()).find(expected), std::string::npos) << e.what();
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST_F(HandleTests, OpenFailureThrows)
+{
+    EXPECT_THROW(
+        Handle(m_dir.Path("missing"), OpenMode::kRead),
+        std::ios::failure
+    );
+}
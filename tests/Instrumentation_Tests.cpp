@@ -0,0 +1,89 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Instrumentation_Tests.cpp                                     //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Only meaningful when built with COREFILE_INSTRUMENTATION.               //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <stdexcept>
+#include <string>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+
+
+#if COREFILE_INSTRUMENTATION
+//----------------------------------------------------------------------------//
+// Helper Types                                                               //
+//----------------------------------------------------------------------------//
+// Does a (successful) read while the stack unwinds.
+struct ReadOnDestruction
+{
+    std::string filename;
+
+    ~ReadOnDestruction()
+    {
+        ReadAllText(filename);
+    }
+};
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(Instrumentation, ThrowingOperationIsAnError)
+{
+    Tests::TempDir dir;
+
+    ResetIoStats();
+    EXPECT_THROW(
+        WriteAllText(dir.Path("missing/file"), "x"),
+        std::exception
+    );
+
+    auto stats = GetIoStats()[IoOperation::WriteAll];
+    EXPECT_EQ(stats.calls,  1u);
+    EXPECT_EQ(stats.errors, 1u);
+}
+
+//------------------------------------------------------------------------------
+TEST(Instrumentation, SuccessDuringUnwindingIsNotAnError)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "contents");
+
+    ResetIoStats();
+    try {
+        ReadOnDestruction reader = { filename };
+        throw std::runtime_error("unwinding");
+    } catch(const std::runtime_error &) {
+        // Expected...
+    }
+
+    auto stats = GetIoStats()[IoOperation::ReadAll];
+    EXPECT_EQ(stats.calls,  1u);
+    EXPECT_EQ(stats.errors, 0u);
+}
+#endif // COREFILE_INSTRUMENTATION
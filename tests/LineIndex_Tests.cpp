@@ -0,0 +1,161 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineIndex_Tests.cpp                                           //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cerrno>
+#include <cstring>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Same layout of LineIndex.cpp.
+static const size_t kHeaderSize      = 8 + 5 * sizeof(uint64_t);
+static const size_t kContentEndField = 8 + 3 * sizeof(uint64_t);
+static const size_t kCountField      = 8 + 4 * sizeof(uint64_t);
+
+// A count that wraps count * 8 around to the size of 3 offsets.
+static const uint64_t kWrappingCount = (uint64_t(1) << 61) + 3;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static void patch_u64(const std::string &filename, size_t offset, uint64_t value)
+{
+    auto contents = ReadAllText(filename);
+    memcpy(&contents[offset], &value, sizeof(value));
+
+    WriteAllText(filename, contents);
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(LineIndex, ReadsLinesWithoutReopeningTheFile)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("text"), "zero\none\n\nthree\n");
+
+    auto index = LineIndex::Build(dir.Path("text"));
+    ASSERT_EQ(index.GetLineCount(), 4u);
+
+    Shim::ScopedShim shim;
+    for(int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(index.ReadLine(0), "zero" );
+        EXPECT_EQ(index.ReadLine(2), ""     );
+        EXPECT_EQ(index.ReadLine(3), "three");
+    }
+
+    EXPECT_EQ(shim.GetCount(Call::Open),  0u);
+    EXPECT_EQ(shim.GetCount(Call::Pread), 200u);
+}
+
+//------------------------------------------------------------------------------
+TEST(LineIndex, CopiesShareTheFile)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("text"), "a\nb");
+
+    LineIndex copy;
+    {
+        auto index = LineIndex::Build(dir.Path("text"));
+        copy = index;
+    }
+
+    EXPECT_EQ(copy.ReadLine(1), "b");
+}
+
+//------------------------------------------------------------------------------
+TEST(LineIndex, LoadsTheSavedSidecar)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("text"), "a\nbb\nccc");
+
+    LineIndex::Build(dir.Path("text")).Save();
+
+    LineIndex index;
+    ASSERT_TRUE(LineIndex::Load(dir.Path("text"), index));
+    EXPECT_EQ  (index.GetLineCount(), 3u);
+    EXPECT_EQ  (index.ReadLine(2), "ccc");
+}
+
+//------------------------------------------------------------------------------
+TEST(LineIndex, RejectsOffsetsThatDontFitTheFile)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("text"), "a\nbb\nccc\n");
+
+    auto sidecar = LineIndex::GetSidecarFilename(dir.Path("text"));
+    auto patches = std::vector<std::pair<size_t, uint64_t>> {
+        { kHeaderSize + 0 * 8, 1              }, // First line not at 0.
+        { kHeaderSize + 1 * 8, 7              }, // Not monotonic.
+        { kHeaderSize + 2 * 8, 100            }, // Past the file.
+        { kContentEndField,    10000          }, // Content past the file.
+        { kContentEndField,    3              }, // Content ends too early.
+        { kCountField,         kWrappingCount }, // Doesn't fit the sidecar.
+    };
+
+    for(const auto &patch : patches)
+    {
+        LineIndex::Build(dir.Path("text")).Save();
+        patch_u64(sidecar, patch.first, patch.second);
+
+        LineIndex index;
+        EXPECT_FALSE(LineIndex::Load(dir.Path("text"), index))
+            << "offset: " << patch.first << " value: " << patch.second;
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(LineIndex, SaveKeepsTheOldSidecarOnFailure)
+{
+    Tests::TempDir dir;
+    WriteAllText(dir.Path("text"), "a\nb\n");
+
+    auto index = LineIndex::Build(dir.Path("text"));
+    index.Save();
+    auto saved = ReadAllText(LineIndex::GetSidecarFilename(dir.Path("text")));
+
+    {
+        Shim::ScopedShim shim;
+        shim.Limit(Call::Write, 7);
+        shim.Fail (Call::Write, ENOSPC);
+
+        EXPECT_THROW(index.Save(), std::runtime_error);
+    }
+
+    EXPECT_EQ(ReadAllText(LineIndex::GetSidecarFilename(dir.Path("text"))), saved);
+}
@@ -0,0 +1,183 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineReader_Tests.cpp                                          //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streaming line reads - Line endings, buffer growth and short reads.     //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cerrno>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+static std::vector<std::string> read_lines(
+    const std::string &filename,
+    size_t             bufferSize = LineReader::kDefaultBufferSize)
+{
+    std::vector<std::string> lines;
+
+    LineReader reader(filename, bufferSize);
+    for(const auto &line : reader)
+        lines.push_back(line.ToString());
+
+    EXPECT_EQ(reader.GetLineNumber(), lines.size());
+    return lines;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TEST(LineReader, EmptyFileHasNoLines)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "");
+
+    LineReader       reader(filename);
+    LineReader::Line line;
+    EXPECT_FALSE(reader.Next(line));
+    EXPECT_FALSE(reader.Next(line));
+    EXPECT_EQ(reader.GetLineNumber(), 0u);
+}
+
+//------------------------------------------------------------------------------
+TEST(LineReader, TrailingNewLineIsOptional)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    auto expected = std::vector<std::string> { "a", "", "ccc" };
+
+    WriteAllText(filename, "a\n\nccc\n");
+    EXPECT_EQ(read_lines(filename), expected);
+
+    WriteAllText(filename, "a\n\nccc");
+    EXPECT_EQ(read_lines(filename), expected);
+
+    WriteAllText(filename, "\n");
+    EXPECT_EQ(read_lines(filename), std::vector<std::string> { "" });
+}
+
+//------------------------------------------------------------------------------
+TEST(LineReader, KeepsTheCarriageReturnOfCRLF)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "a\r\n\r\nbb\r\nmixed\ncc\r");
+
+    auto expected = std::vector<std::string> {
+        "a\r", "\r", "bb\r", "mixed", "cc\r"
+    };
+    EXPECT_EQ(read_lines(filename),    expected);
+    EXPECT_EQ(read_lines(filename, 2), expected);
+}
+
+//------------------------------------------------------------------------------
+TEST(LineReader, GrowsForLinesLongerThanTheBuffer)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    auto expected = std::vector<std::string> {
+        "short",
+        std::string(1000, 'x'),
+        "",
+        std::string(70000, 'y'),
+        "z"
+    };
+
+    std::string contents;
+    for(const auto &line : expected)
+        contents += line + "\n";
+    contents.pop_back();
+    WriteAllText(filename, contents);
+
+    EXPECT_EQ(read_lines(filename, 1),  expected);
+    EXPECT_EQ(read_lines(filename, 16), expected);
+}
+
+//------------------------------------------------------------------------------
+TEST(LineReader, MatchesReadAllLines)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    // Random bytes have a '\n' every 256 bytes or so.
+    auto contents = Tests::MakeData(3 * 1024 * 1024 + 17);
+    contents.push_back('\n');
+    WriteAllText(filename, contents);
+
+    // ReadAllLines gives an extra empty line for the trailing '\n'.
+    auto expected = ReadAllLines(filename);
+    ASSERT_EQ(expected.back(), "");
+    expected.pop_back();
+
+    EXPECT_EQ(read_lines(filename),       expected);
+    EXPECT_EQ(read_lines(filename, 4096), expected);
+}
+
+//------------------------------------------------------------------------------
+TEST(LineReader, HandlesShortAndInterruptedReads)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+    WriteAllText(filename, "first\nsecond line\nthird");
+
+    Shim::ScopedShim shim;
+    shim.Limit    (Call::Read, 3);
+    shim.Interrupt(Call::Read, 4);
+
+    auto expected = std::vector<std::string> { "first", "second line", "third" };
+    EXPECT_EQ(read_lines(filename), expected);
+}
+
+//------------------------------------------------------------------------------
+TEST(LineReader, ReportsTheErrors)
+{
+    Tests::TempDir dir;
+    auto filename = dir.Path("file");
+
+    EXPECT_THROW(LineReader reader(filename), std::ios::failure);
+
+    WriteAllText(filename, "a\nb\n");
+    LineReader reader(filename);
+
+    Shim::ScopedShim shim;
+    shim.Fail(Call::Read, EIO);
+
+    LineReader::Line line;
+    EXPECT_THROW(reader.Next(line), std::runtime_error);
+}
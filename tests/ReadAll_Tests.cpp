@@ -0,0 +1,144 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ReadAll_Tests.cpp                                             //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Syscall budget of ReadAllBytes / ReadAllLines / ReadAllText: one        //
+//    open(2), one fstat(2) and one pread(2) - No read(2) at all.             //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <string>
+#include <vector>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Empty files need their pread too - fstat(2) reports 0 for /proc files
+// as well, so only EOF tells them apart.
+static void expect_single_read(const Shim::ScopedShim &shim)
+{
+    EXPECT_EQ(shim.GetCount(Call::Open),  1u);
+    EXPECT_EQ(shim.GetCount(Call::Fstat), 1u);
+    EXPECT_EQ(shim.GetCount(Call::Pread), 1u);
+    EXPECT_EQ(shim.GetCount(Call::Read),  0u);
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+class ReadAllSyscalls :
+    public testing::TestWithParam<size_t>
+{
+protected:
+    void SetUp() override
+    {
+        m_filename = m_dir.Path("data");
+        m_data     = Tests::MakeData(GetParam());
+        WriteAllText(m_filename, m_data);
+    }
+
+protected:
+    Tests::TempDir m_dir;
+    std::string    m_filename;
+    std::string    m_data;
+};
+
+//------------------------------------------------------------------------------
+TEST_P(ReadAllSyscalls, ReadAllBytes)
+{
+    std::vector<byte_t> bytes;
+    {
+        Shim::ScopedShim shim;
+        bytes = ReadAllBytes(m_filename);
+        expect_single_read(shim);
+    }
+
+    EXPECT_EQ(std::string(bytes.begin(), bytes.end()), m_data);
+}
+
+//------------------------------------------------------------------------------
+TEST_P(ReadAllSyscalls, ReadAllText)
+{
+    std::string text;
+    {
+        Shim::ScopedShim shim;
+        text = ReadAllText(m_filename);
+        expect_single_read(shim);
+    }
+
+    EXPECT_EQ(text, m_data);
+}
+
+//------------------------------------------------------------------------------
+TEST_P(ReadAllSyscalls, ReadAllLines)
+{
+    std::vector<std::string> lines;
+    {
+        Shim::ScopedShim shim;
+        lines = ReadAllLines(m_filename);
+        expect_single_read(shim);
+    }
+
+    auto newlines = std::count(m_data.begin(), m_data.end(), '\n');
+    EXPECT_EQ(lines.size(), static_cast<size_t>(newlines) + 1);
+}
+
+//------------------------------------------------------------------------------
+TEST_P(ReadAllSyscalls, ShortReadsAreResumed)
+{
+    if(m_data.empty())
+        return;
+
+    Shim::ScopedShim shim;
+    shim.Limit(Call::Pread, 1000);
+
+    auto text = ReadAllText(m_filename);
+    EXPECT_EQ(text, m_data);
+    EXPECT_EQ(shim.GetCount(Call::Pread), (m_data.size() + 999) / 1000);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Payloads,
+    ReadAllSyscalls,
+    testing::Values(0, 1, 4096, 64 * 1024, 1024 * 1024)
+);
+
+//------------------------------------------------------------------------------
+TEST(ReadAll, MissingFileOnlyOpens)
+{
+    Tests::TempDir dir;
+
+    Shim::ScopedShim shim;
+    EXPECT_TRUE(ReadAllBytes(dir.Path("missing")).empty());
+    EXPECT_EQ(shim.GetCount(Call::Open),  1u);
+    EXPECT_EQ(shim.GetCount(Call::Fstat), 0u);
+    EXPECT_EQ(shim.GetCount(Call::Pread), 0u);
+}
@@ -0,0 +1,374 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Syscall_Shim.cpp                                              //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "Syscall_Shim.h"
+// std
+#include <cerrno>
+#include <cstdarg>
+#include <utility>
+// POSIX
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Usings
+using namespace Shim;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+struct CallState
+{
+    uint64_t count;
+    int      error;
+    int      faults;
+    int      faultError;
+    size_t   maxBytes;
+    bool     eof;
+
+    std::function<void ()> hook;
+};
+
+struct ShimState
+{
+    CallState calls[kCallCount];
+};
+
+
+//----------------------------------------------------------------------------//
+// Variables                                                                  //
+//----------------------------------------------------------------------------//
+// nullptr when there's no ScopedShim on the thread.
+static thread_local ShimState *t_pState = nullptr;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Returns true if the call must fail (errno is set), otherwise the call
+// goes to libc with size shortened to the limit.
+static bool intercept(Call call, size_t &size)
+{
+    if(!t_pState)
+        return false;
+
+    auto &state = t_pState->calls[static_cast<size_t>(call)];
+    ++state.count;
+
+    if(state.hook)
+    {
+        auto p_state = t_pState;
+        t_pState = nullptr;
+        state.hook();
+        t_pState = p_state;
+    }
+
+    if(state.faults > 0)
+    {
+        --state.faults;
+        errno = state.faultError;
+        return true;
+    }
+    if(state.error != 0)
+    {
+        errno = state.error;
+        return true;
+    }
+
+    if(state.maxBytes != 0 && size > state.maxBytes)
+        size = state.maxBytes;
+    if(state.eof)
+        size = 0;
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+static bool intercept(Call call)
+{
+    auto size = size_t(0);
+    return intercept(call, size);
+}
+
+//------------------------------------------------------------------------------
+template <typename Func>
+static Func real(Func, const char *pName)
+{
+    return reinterpret_cast<Func>(dlsym(RTLD_NEXT, pName));
+}
+
+//------------------------------------------------------------------------------
+// Shortens the first buffer - The iovec array is the caller's, so a
+// copy is made.
+struct ShortIov
+{
+    iovec        first;
+    const iovec *pIov;
+    int          count;
+
+    ShortIov(Call call, const iovec *pOriginal, int originalCount) :
+        // Members.
+        pIov (pOriginal),
+        count(originalCount)
+    {
+        auto size = (count > 0) ? pOriginal[0].iov_len : 0;
+        if(count > 0 && t_pState)
+        {
+            auto &state = t_pState->calls[static_cast<size_t>(call)];
+            if(state.maxBytes != 0 && size > state.maxBytes)
+            {
+                first         = pOriginal[0];
+                first.iov_len = state.maxBytes;
+                pIov          = &first;
+                count         = 1;
+            }
+        }
+    }
+};
+
+
+//----------------------------------------------------------------------------//
+// ScopedShim                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+ScopedShim::ScopedShim()
+{
+    t_pState = new ShimState();
+}
+
+//------------------------------------------------------------------------------
+ScopedShim::~ScopedShim()
+{
+    delete t_pState;
+    t_pState = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::Fail(Call call, int error)
+{
+    t_pState->calls[static_cast<size_t>(call)].error = error;
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::FailFirst(Call call, int error, int times)
+{
+    auto &state = t_pState->calls[static_cast<size_t>(call)];
+    state.faults     = times;
+    state.faultError = error;
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::Interrupt(Call call, int times)
+{
+    FailFirst(call, EINTR, times);
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::Limit(Call call, size_t maxBytes)
+{
+    t_pState->calls[static_cast<size_t>(call)].maxBytes = maxBytes;
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::Eof(Call call)
+{
+    t_pState->calls[static_cast<size_t>(call)].eof = true;
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::Before(Call call, std::function<void ()> hook)
+{
+    t_pState->calls[static_cast<size_t>(call)].hook = std::move(hook);
+}
+
+//------------------------------------------------------------------------------
+uint64_t ScopedShim::GetCount(Call call) const
+{
+    return t_pState->calls[static_cast<size_t>(call)].count;
+}
+
+//------------------------------------------------------------------------------
+void ScopedShim::ResetCounts()
+{
+    for(auto &state : t_pState->calls)
+        state.count = 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// libc                                                                       //
+//----------------------------------------------------------------------------//
+extern "C" {
+
+//------------------------------------------------------------------------------
+int open(const char *pPath, int flags, ...)
+{
+    static auto p_real = real(&open, "open");
+
+    mode_t mode = 0;
+    if(flags & (O_CREAT | O_TMPFILE))
+    {
+        va_list args;
+        va_start(args, flags);
+        mode = va_arg(args, mode_t);
+        va_end(args);
+    }
+
+    if(intercept(Call::Open))
+        return -1;
+    return p_real(pPath, flags, mode);
+}
+
+//------------------------------------------------------------------------------
+int fstat(int fd, struct stat *pStat) throw()
+{
+    static auto p_real = real(&fstat, "fstat");
+    if(intercept(Call::Fstat))
+        return -1;
+    return p_real(fd, pStat);
+}
+
+//------------------------------------------------------------------------------
+ssize_t read(int fd, void *pData, size_t size)
+{
+    static auto p_real = real(&read, "read");
+    if(intercept(Call::Read, size))
+        return -1;
+    return p_real(fd, pData, size);
+}
+
+//------------------------------------------------------------------------------
+ssize_t pread(int fd, void *pData, size_t size, off_t offset)
+{
+    static auto p_real = real(&pread, "pread");
+    if(intercept(Call::Pread, size))
+        return -1;
+    return p_real(fd, pData, size, offset);
+}
+
+//------------------------------------------------------------------------------
+ssize_t readv(int fd, const iovec *pIov, int count)
+{
+    static auto p_real = real(&readv, "readv");
+    if(intercept(Call::Readv))
+        return -1;
+
+    ShortIov iov(Call::Readv, pIov, count);
+    return p_real(fd, iov.pIov, iov.count);
+}
+
+//------------------------------------------------------------------------------
+ssize_t preadv(int fd, const iovec *pIov, int count, off_t offset)
+{
+    static auto p_real = real(&preadv, "preadv");
+    if(intercept(Call::Preadv))
+        return -1;
+
+    ShortIov iov(Call::Preadv, pIov, count);
+    return p_real(fd, iov.pIov, iov.count, offset);
+}
+
+//------------------------------------------------------------------------------
+ssize_t write(int fd, const void *pData, size_t size)
+{
+    static auto p_real = real(&write, "write");
+    if(intercept(Call::Write, size))
+        return -1;
+    return p_real(fd, pData, size);
+}
+
+//------------------------------------------------------------------------------
+ssize_t pwrite(int fd, const void *pData, size_t size, off_t offset)
+{
+    static auto p_real = real(&pwrite, "pwrite");
+    if(intercept(Call::Pwrite, size))
+        return -1;
+    return p_real(fd, pData, size, offset);
+}
+
+//------------------------------------------------------------------------------
+ssize_t writev(int fd, const iovec *pIov, int count)
+{
+    static auto p_real = real(&writev, "writev");
+    if(intercept(Call::Writev))
+        return -1;
+
+    ShortIov iov(Call::Writev, pIov, count);
+    return p_real(fd, iov.pIov, iov.count);
+}
+
+//------------------------------------------------------------------------------
+ssize_t pwritev(int fd, const iovec *pIov, int count, off_t offset)
+{
+    static auto p_real = real(&pwritev, "pwritev");
+    if(intercept(Call::Pwritev))
+        return -1;
+
+    ShortIov iov(Call::Pwritev, pIov, count);
+    return p_real(fd, iov.pIov, iov.count, offset);
+}
+
+//------------------------------------------------------------------------------
+ssize_t copy_file_range(
+    int      srcFd,
+    off64_t *pSrcOffset,
+    int      dstFd,
+    off64_t *pDstOffset,
+    size_t   size,
+    unsigned flags)
+{
+    static auto p_real = real(&copy_file_range, "copy_file_range");
+    if(intercept(Call::CopyFileRange, size))
+        return -1;
+    return p_real(srcFd, pSrcOffset, dstFd, pDstOffset, size, flags);
+}
+
+//------------------------------------------------------------------------------
+ssize_t sendfile(int dstFd, int srcFd, off_t *pOffset, size_t size) throw()
+{
+    static auto p_real = real(&sendfile, "sendfile");
+    if(intercept(Call::Sendfile, size))
+        return -1;
+    return p_real(dstFd, srcFd, pOffset, size);
+}
+
+//------------------------------------------------------------------------------
+int ioctl(int fd, unsigned long request, ...) throw()
+{
+    static auto p_real = real(&ioctl, "ioctl");
+
+    va_list args;
+    va_start(args, request);
+    auto p_arg = va_arg(args, void *);
+    va_end(args);
+
+    if(intercept(Call::Ioctl))
+        return -1;
+    return p_real(fd, request, p_arg);
+}
+
+} // extern "C"
@@ -0,0 +1,112 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Syscall_Shim.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Counts and injects faults in the syscalls made by the calling           //
+//    thread - The test binary defines the libc functions, so the ones        //
+//    in the library resolve to them.                                         //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+
+namespace Shim {
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+enum class Call
+{
+    Open,
+    Fstat,
+    Read,
+    Pread,
+    Readv,
+    Preadv,
+    Write,
+    Pwrite,
+    Writev,
+    Pwritev,
+    CopyFileRange,
+    Sendfile,
+    Ioctl
+};
+
+constexpr size_t kCallCount = 13;
+
+
+//----------------------------------------------------------------------------//
+// ScopedShim                                                                 //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   While in scope the calls of the calling thread are counted and the
+///   configured faults are injected - Other threads are never affected.
+class ScopedShim
+{
+public:
+    ScopedShim();
+    ~ScopedShim();
+
+    ScopedShim(const ScopedShim &)            = delete;
+    ScopedShim& operator =(const ScopedShim &) = delete;
+
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Makes every call fail with the errno.
+    void Fail(Call call, int error);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the first times calls fail with the errno.
+    void FailFirst(Call call, int error, int times);
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the first times calls fail with EINTR.
+    void Interrupt(Call call, int times);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Transfers at most maxBytes per call - Short reads / writes.
+    ///   For the vectored calls only the first buffer is shortened.
+    void Limit(Call call, size_t maxBytes);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Makes every call transfer nothing (return 0) - Like the in
+    ///   kernel copies on procfs / sysfs with older kernels.
+    void Eof(Call call);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Runs hook before every call - Its own calls aren't intercepted.
+    ///   Useful to make something happen in the middle of an operation.
+    void Before(Call call, std::function<void ()> hook);
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many times the call was made (failed ones included).
+    uint64_t GetCount(Call call) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Zeros the counters.
+    void ResetCounts();
+};
+
+} // namespace Shim
@@ -0,0 +1,89 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Test_Helpers.h                                                //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Temporary directories and data shared by the tests.                     //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdlib>
+#include <string>
+// POSIX
+#include <ftw.h>
+#include <unistd.h>
+
+
+namespace Tests {
+
+///-----------------------------------------------------------------------------
+/// @brief A directory under TMPDIR removed (recursively) at the end.
+class TempDir
+{
+public:
+    TempDir()
+    {
+        auto p_tmp = getenv("TMPDIR");
+        m_path = std::string(p_tmp ? p_tmp : "/tmp") + "/CoreFile_tests_XXXXXX";
+        if(!mkdtemp(&m_path[0]))
+            abort();
+    }
+
+    ~TempDir()
+    {
+        nftw(
+            m_path.c_str(),
+            [](const char *pPath, const struct stat *, int, FTW *) {
+                return remove(pPath);
+            },
+            16,
+            FTW_DEPTH | FTW_PHYS
+        );
+    }
+
+    TempDir(const TempDir &)            = delete;
+    TempDir& operator =(const TempDir &) = delete;
+
+public:
+    std::string Path(const std::string &name) const
+    {
+        return m_path + "/" + name;
+    }
+
+private:
+    std::string m_path;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief Deterministic bytes that don't compress too well.
+inline std::string MakeData(size_t size)
+{
+    std::string data(size, '\0');
+
+    auto state = uint32_t(2463534242u);
+    for(auto &c : data)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        c = char(state);
+    }
+
+    return data;
+}
+
+} // namespace Tests
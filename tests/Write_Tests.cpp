@@ -0,0 +1,182 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Write_Tests.cpp                                               //
+//  Project   : CoreFile                                                      //
+//  Date      : Oct 16, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+// GTest
+#include <gtest/gtest.h>
+// CoreFile
+#include "CoreFile/CoreFile.h"
+// Tests
+#include "Syscall_Shim.h"
+#include "Test_Helpers.h"
+
+// Usings
+using namespace CoreFile;
+using Shim::Call;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// What WriteAllBytes did before the bulk path - One formatted stream
+// insertion per byte.
+static void legacy_write_all_bytes(
+    const std::string         &filename,
+    const std::vector<byte_t> &bytes)
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    std::copy(bytes.begin(), bytes.end(), std::ostream_iterator<byte_t>(file));
+}
+
+//------------------------------------------------------------------------------
+// What WriteAllLines did before the bulk path - One insertion per line.
+static void legacy_write_all_lines(
+    const std::string              &filename,
+    const std::vector<std::string> &lines)
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    for(const auto &line : lines)
+        file << line << "\n";
+}
+
+//------------------------------------------------------------------------------
+static std::vector<std::string> make_lines(size_t count)
+{
+    std::vector<std::string> lines;
+    for(size_t i = 0; i < count; ++i)
+        lines.push_back("line " + std::to_string(i) + std::string(i % 40, 'x'));
+
+    return lines;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+class WriteAllSizes :
+    public testing::TestWithParam<size_t>
+{
+};
+
+//------------------------------------------------------------------------------
+TEST_P(WriteAllSizes, WritesTheBufferWithASingleWrite)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(GetParam());
+
+    {
+        Shim::ScopedShim shim;
+        WriteAllText(dir.Path("text"), data);
+
+        EXPECT_EQ(shim.GetCount(Call::Open),  1u);
+        EXPECT_EQ(shim.GetCount(Call::Write), (data.empty()) ? 0u : 1u);
+    }
+
+    EXPECT_EQ(ReadAllText(dir.Path("text")), data);
+
+    std::vector<byte_t> bytes(data.begin(), data.end());
+    WriteAllBytes(dir.Path("bytes"), bytes);
+    EXPECT_EQ(ReadAllBytes(dir.Path("bytes")), bytes);
+
+    WriteAllBytes(dir.Path("raw"), data.data(), data.size(), WriteMode::Atomic);
+    EXPECT_EQ(ReadAllText(dir.Path("raw")), data);
+}
+
+//------------------------------------------------------------------------------
+TEST_P(WriteAllSizes, MatchesTheLegacyPath)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(GetParam());
+    std::vector<byte_t> bytes(data.begin(), data.end());
+
+    legacy_write_all_bytes(dir.Path("legacy"), bytes);
+    WriteAllBytes         (dir.Path("bulk"),   bytes);
+
+    EXPECT_EQ(ReadAllBytes(dir.Path("bulk")), ReadAllBytes(dir.Path("legacy")));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Payloads,
+    WriteAllSizes,
+    testing::Values(0, 1, 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024)
+);
+
+//------------------------------------------------------------------------------
+TEST(WriteAll, LinesMatchTheLegacyLoop)
+{
+    Tests::TempDir dir;
+    auto lines = make_lines(10000);
+
+    legacy_write_all_lines(dir.Path("legacy"), lines);
+    {
+        Shim::ScopedShim shim;
+        WriteAllLines(dir.Path("bulk"), lines);
+
+        EXPECT_EQ(shim.GetCount(Call::Write), 1u);
+    }
+
+    EXPECT_EQ(ReadAllText(dir.Path("bulk")), ReadAllText(dir.Path("legacy")));
+    EXPECT_EQ(ReadAllLines(dir.Path("bulk")).size(), lines.size() + 1);
+}
+
+//------------------------------------------------------------------------------
+TEST(WriteAll, HandlesShortWritesAndEintr)
+{
+    Tests::TempDir dir;
+    auto data = Tests::MakeData(1024 * 1024 + 5);
+
+    for(auto mode : { WriteMode::Truncate, WriteMode::Atomic })
+    {
+        {
+            Shim::ScopedShim shim;
+            shim.Limit    (Call::Write, 4093);
+            shim.Interrupt(Call::Write, 3);
+
+            WriteAllText(dir.Path("file"), data, mode);
+            EXPECT_GE(shim.GetCount(Call::Write), data.size() / 4093);
+        }
+
+        EXPECT_EQ(ReadAllText(dir.Path("file")), data);
+    }
+}
+
+//------------------------------------------------------------------------------
+TEST(WriteAll, ThrowsOnWriteErrors)
+{
+    Tests::TempDir dir;
+
+    {
+        Shim::ScopedShim shim;
+        shim.Fail(Call::Write, ENOSPC);
+
+        EXPECT_THROW(WriteAllText(dir.Path("file"), "data"), std::runtime_error);
+        EXPECT_THROW(
+            WriteAllText(dir.Path("atomic"), "data", WriteMode::Atomic),
+            std::runtime_error
+        );
+    }
+
+    // The atomic write never leaves the file (or its temp) behind.
+    EXPECT_FALSE(Exist(dir.Path("atomic")));
+}